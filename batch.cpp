@@ -0,0 +1,302 @@
+/***********************************************************************
+ * Source File:
+ *    BATCH : Play many games as fast as possible
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The file that contains main() for skeet-batch. There is no window:
+ *    a bot plays complete games (every level through to Game Over) back
+ *    to back, and at the end we report how fast the simulation ran and
+ *    how the games turned out.
+ *
+ *    skeet-batch [-n games] [-s seed] [-b aim|random|idle] [-r] [-w file]
+ *                [-p file] [-j threads] [-l levels] [-S kinds]
+ *
+ *    With -r every game is played in the same Skeet, restarting it with
+ *    the space bar the way a player would. That is our soak test: the
+ *    memory the game holds after the last game should be no more than
+ *    the busiest frame of any game needed.
+ *
+ *    With -w the first game is also written out as a replay, so the
+ *    exact same game can be played again with skeet-replay.
+ *
+ *    With -p every stage of every frame is timed and written to the file
+ *    as CSV, and the slowest stages are reported at the end.
+ *
+ *    With -j each frame moves its birds, bullets, and fragments on that
+ *    many threads (0 is one per core) when there are enough of them to
+ *    be worth it. The games come out exactly the same.
+ *
+ *    With -l the games play the levels in that file instead of the
+ *    standard ones.
+ *
+ *    With -S there are no games. Instead one long game is stress tested
+ *    (see stress.h): kinds is "all" or a list of birds, missiles, bombs,
+ *    and fragments, and their number doubles until the simulation falls
+ *    off a cliff. Only the simulation is timed; the window (skeet -S)
+ *    times the drawing too. -s, -j, and -p apply to it as well.
+ ************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "skeet.h"
+#include "bot.h"
+#include "replay.h"
+#include "profiler.h"
+#include "jobs.h"
+#include "stress.h"
+using namespace std;
+
+#define WIDTH  800.0
+#define HEIGHT 800.0
+
+/*********************************************
+ * DISPLAY DISTRIBUTION
+ * min, percentiles, max, and mean of a set of results
+ *********************************************/
+void displayDistribution(const char * label, vector<double> values)
+{
+   assert(!values.empty());
+   sort(values.begin(), values.end());
+   double sum = 0.0;
+   for (double value : values)
+      sum += value;
+   auto percentile = [&values](double percent)
+   {
+      return values[(size_t)(percent * (values.size() - 1) + 0.5)];
+   };
+
+   cout << setw(12) << left << label << right << fixed << setprecision(1)
+        << " min " << setw(7) << values.front()
+        << "  p10 " << setw(7) << percentile(0.10)
+        << "  p50 " << setw(7) << percentile(0.50)
+        << "  p90 " << setw(7) << percentile(0.90)
+        << "  max " << setw(7) << values.back()
+        << "  mean " << setw(7) << sum / values.size() << endl;
+}
+
+/*********************************************
+ * DISPLAY PROFILE
+ * Where the time went, over the last few hundred frames
+ *********************************************/
+void displayProfile(const Profiler & profiler)
+{
+   cout << fixed << setprecision(4) << "stage              min (ms)  avg (ms)  p99 (ms)\n";
+   for (int stage = STAGE_INTERACT; stage < STAGE_DRAW_BACKGROUND; stage++)
+      cout << "  " << setw(15) << left << getName((Stage)stage) << right
+           << setw(10) << profiler.getMin((Stage)stage)
+           << setw(10) << profiler.getAverage((Stage)stage)
+           << setw(10) << profiler.getP99((Stage)stage) << endl;
+}
+
+/*********************************************
+ * STRESS TEST
+ * One long game, topped up to a bigger load every
+ * step, with nothing pressed and nothing drawn
+ *********************************************/
+void stressTest(int kinds, uint64_t seed, JobSystem * jobs, Profiler * profiler)
+{
+   Position dimensions(WIDTH, HEIGHT);
+   Skeet skeet(dimensions, seed, &Stress::getLevels());
+   skeet.setJobs(jobs);
+   skeet.setProfiler(profiler);
+
+   Stress stress(kinds);
+   while (!stress.isDone())
+   {
+      stress.fill(skeet);
+      auto begin = chrono::steady_clock::now();
+      skeet.interact(Input());
+      skeet.animate();
+      double simulate = chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count();
+      if (profiler)
+         profiler->endFrame();
+      stress.record(skeet, simulate, -1.0);
+   }
+   stress.report(cout);
+}
+
+/*********************************************
+ * USAGE
+ *********************************************/
+int usage(const char * program)
+{
+   cerr << "usage: " << program << " [-n games] [-s seed] [-b " BOT_NAMES "] [-r] [-w file] [-p file] [-j threads] [-l levels]\n"
+        << "       " << program << " -S all|birds,missiles,bombs,fragments [-s seed] [-j threads] [-p file]\n";
+   return 1;
+}
+
+/*********************************
+ * MAIN
+ * Play the games, then report
+ *********************************/
+int main(int argc, char ** argv)
+{
+   int numGames = 100;
+   uint64_t seed = (uint64_t)time(NULL);
+   string botName = "aim";
+   bool reuse = false;
+   const char * replayFile = NULL;
+   const char * profileFile = NULL;
+   int numThreads = 1;
+   Levels levels;
+   int stressKinds = 0;
+
+   // read the command line
+   for (int i = 1; i < argc; i++)
+   {
+      if (i + 1 < argc && strcmp(argv[i], "-n") == 0)
+         numGames = atoi(argv[++i]);
+      else if (i + 1 < argc && strcmp(argv[i], "-s") == 0)
+         seed = strtoull(argv[++i], NULL, 10);
+      else if (i + 1 < argc && strcmp(argv[i], "-b") == 0)
+         botName = argv[++i];
+      else if (strcmp(argv[i], "-r") == 0)
+         reuse = true;
+      else if (i + 1 < argc && strcmp(argv[i], "-w") == 0)
+         replayFile = argv[++i];
+      else if (i + 1 < argc && strcmp(argv[i], "-p") == 0)
+         profileFile = argv[++i];
+      else if (i + 1 < argc && strcmp(argv[i], "-j") == 0)
+         numThreads = atoi(argv[++i]);
+      else if (i + 1 < argc && strcmp(argv[i], "-l") == 0)
+      {
+         if (!levels.load(argv[++i]))
+         {
+            cerr << levels.getError() << endl;
+            return 1;
+         }
+      }
+      else if (i + 1 < argc && strcmp(argv[i], "-S") == 0)
+      {
+         stressKinds = Stress::parseKinds(argv[++i]);
+         if (stressKinds == 0)
+            return usage(argv[0]);
+      }
+      else
+         return usage(argv[0]);
+   }
+   if (numGames <= 0 || newBot(botName) == nullptr)
+      return usage(argv[0]);
+
+   Profiler profiler;
+   if (profileFile)
+   {
+      if (!profiler.openCsv(profileFile))
+      {
+         cerr << "cannot write profile " << profileFile << endl;
+         return 1;
+      }
+      profiler.setEnabled(true);
+   }
+
+   unique_ptr<JobSystem> jobs;
+   if (numThreads != 1)
+      jobs.reset(new JobSystem(numThreads));
+
+   // a stress test instead of games
+   if (stressKinds)
+   {
+      stressTest(stressKinds, seed, jobs.get(), profileFile ? &profiler : NULL);
+      if (profileFile)
+         displayProfile(profiler);
+      return 0;
+   }
+
+   Position dimensions(WIDTH, HEIGHT);
+   vector<double> scores;
+   vector<double> ratios;
+   long long numFrames = 0;
+   size_t liveMax = 0;
+   size_t bytesMax = 0;
+   size_t bytesFirst = 0;
+   size_t bytesLast = 0;
+
+   // play every game from the first level to Game Over. Without -r, game n
+   // is seeded with seed + n so any one of them can be played again on its
+   // own. With -r, every game after the first plays on in game 0's Skeet,
+   // with its random numbers where the game before left them
+   unique_ptr<Skeet> pSkeet;
+   Replay replay(seed, dimensions);
+   auto begin = chrono::steady_clock::now();
+   for (int game = 0; game < numGames; game++)
+   {
+      // a fresh game, or press space to play again
+      if (!reuse || !pSkeet)
+         pSkeet.reset(new Skeet(dimensions, seed + game, &levels));
+      else
+      {
+         Input restart;
+         restart.setSpace(1);
+         pSkeet->interact(restart);
+      }
+      Skeet & skeet = *pSkeet;
+      skeet.setProfiler(profileFile ? &profiler : NULL);
+      skeet.setJobs(jobs.get());
+
+      unique_ptr<Bot> bot = newBot(botName, ~(seed + game));
+      while (!skeet.getTime().isGameOver())
+      {
+         {
+            ProfileScope scope(profileFile ? &profiler : NULL, STAGE_INTERACT);
+            Input input = bot->play(skeet);
+            if (game == 0 && replayFile)
+               replay.record(input);
+            skeet.interact(input);
+         }
+         skeet.animate();
+         if (profileFile)
+            profiler.endFrame();
+         numFrames++;
+         liveMax = max(liveMax, skeet.getLiveObjects());
+      }
+      bytesLast = skeet.getBytesAllocated();
+      bytesMax = max(bytesMax, bytesLast);
+      if (game == 0)
+         bytesFirst = bytesLast;
+
+      const HitRatio & hitRatio = skeet.getHitRatio();
+      int numBirds = hitRatio.getKilled() + hitRatio.getMissed();
+      scores.push_back(skeet.getScore().getPoints());
+      ratios.push_back(numBirds ? 100.0 * hitRatio.getKilled() / numBirds : 0.0);
+   }
+   double seconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+   if (replayFile && !replay.save(replayFile))
+   {
+      cerr << "cannot write replay " << replayFile << endl;
+      return 1;
+   }
+
+   // report
+   cout << "bot:         " << botName << endl;
+   cout << "seed:        " << seed << endl;
+   cout << "games:       " << numGames << endl;
+   if (jobs)
+      cout << "threads:     " << jobs->getThreads() << endl;
+   cout << "frames:      " << numFrames << endl;
+   cout << fixed << setprecision(3);
+   cout << "seconds:     " << seconds << endl;
+   cout << setprecision(1);
+   cout << "games/sec:   " << numGames / seconds << endl;
+   cout << "frames/sec:  " << numFrames / seconds << endl;
+   displayDistribution("score", scores);
+   displayDistribution("hit ratio %", ratios);
+   cout << "live peak:   " << liveMax << " objects" << endl;
+   cout << "memory:      " << bytesFirst << " bytes after the first game, "
+        << bytesLast << " after the last, " << bytesMax << " peak" << endl;
+
+   // where the time went, over the last few hundred frames
+   if (profileFile)
+      displayProfile(profiler);
+
+   return 0;
+}
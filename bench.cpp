@@ -0,0 +1,149 @@
+/***********************************************************************
+ * Source File:
+ *    BENCH : Time the pieces of the simulation on their own
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The file that contains main() for skeet-bench. It times the bird
+ *    and bullet hit test (every kernel this processor can run is given
+ *    the same birds and bullets, and we report how many bird and bullet
+ *    pairs it tests a second) and the random numbers the particles use,
+ *    Random against the rand() the game used to call.
+ *
+ *    skeet-bench [-t seconds]
+ ************************************************************************/
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "collision.h"
+#include "random.h"
+using namespace std;
+
+#define NUM_BULLETS 1024
+
+/*********************************************
+ * RANDOM
+ * A number in [min, max]
+ *********************************************/
+double random(double min, double max)
+{
+   return min + ((double)rand() / (double)RAND_MAX * (max - min));
+}
+
+/*********************************************
+ * BENCH COLLIDE
+ * Test every bullet against a block of birds over and
+ * over for about [seconds]. Return the pairs per second.
+ *********************************************/
+double benchCollide(Isa isa, int numBirds, double seconds)
+{
+   // the same birds and bullets for every kernel
+   srand(331);
+   BirdBlock block;
+   block.setIsa(isa);
+   for (int i = 0; i < numBirds; i++)
+      block.add(Position(random(0.0, 800.0), random(0.0, 800.0)),
+                Velocity(random(-8.0, 8.0), random(-8.0, 8.0)),
+                random(15.0, 30.0));
+   vector<Position> pts;
+   vector<Velocity> vs;
+   for (int i = 0; i < NUM_BULLETS; i++)
+   {
+      pts.push_back(Position(random(0.0, 800.0), random(0.0, 800.0)));
+      vs.push_back(Velocity(random(-30.0, 30.0), random(-30.0, 30.0)));
+   }
+
+   vector<int> hits;
+   size_t pairs = 0;
+   size_t numHits = 0;
+   auto start = chrono::steady_clock::now();
+   double elapsed = 0.0;
+   while (elapsed < seconds)
+   {
+      for (int i = 0; i < NUM_BULLETS; i++)
+      {
+         hits.clear();
+         block.collide(pts[i], vs[i], 0.5, hits);
+         numHits += hits.size();
+      }
+      pairs += (size_t)NUM_BULLETS * numBirds;
+      elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+   }
+
+   // keep the compiler from throwing the work away
+   if (numHits == (size_t)-1)
+      cout << numHits;
+   return pairs / elapsed;
+}
+
+/*********************************************
+ * BENCH RANDOM
+ * Draw doubles for about [seconds], either from rand()
+ * or from Random. Return the numbers per second.
+ *********************************************/
+double benchRandom(bool useRand, double seconds)
+{
+   Random generator(331);
+   srand(331);
+   double sum = 0.0;
+   size_t count = 0;
+   auto start = chrono::steady_clock::now();
+   double elapsed = 0.0;
+   while (elapsed < seconds)
+   {
+      if (useRand)
+         for (int i = 0; i < 100000; i++)
+            sum += random(-6.0, 6.0);
+      else
+         for (int i = 0; i < 100000; i++)
+            sum += generator.nextDouble(-6.0, 6.0);
+      count += 100000;
+      elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+   }
+
+   // keep the compiler from throwing the work away
+   if (sum == 1.0e300)
+      cout << sum;
+   return count / elapsed;
+}
+
+/*********************************************
+ * MAIN
+ *********************************************/
+int main(int argc, char ** argv)
+{
+   double seconds = 0.5;
+   for (int i = 1; i < argc; i++)
+   {
+      if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+         seconds = atof(argv[++i]);
+      else
+      {
+         cerr << "usage: skeet-bench [-t seconds]\n";
+         return 1;
+      }
+   }
+
+   cout << "collide (best is " << getName(bestIsa()) << ")\n";
+   for (int numBirds : { 4, 16, 64, 256 })
+   {
+      cout << "   " << setw(4) << numBirds << " birds";
+      for (Isa isa : { ISA_SCALAR, ISA_SSE2, ISA_AVX2 })
+      {
+         if (!isSupported(isa))
+            continue;
+         cout << "   " << setw(6) << getName(isa) << " " << fixed << setprecision(1)
+              << setw(7) << benchCollide(isa, numBirds, seconds) / 1.0e6 << "M pairs/s";
+      }
+      cout << endl;
+   }
+
+   cout << "random doubles\n" << fixed << setprecision(1)
+        << "   rand()   " << setw(7) << benchRandom(true,  seconds) / 1.0e6 << "M/s\n"
+        << "   Random   " << setw(7) << benchRandom(false, seconds) / 1.0e6 << "M/s\n";
+   return 0;
+}
@@ -10,55 +10,6 @@
 #include <cassert>
 #include "bird.h"
 
-#ifdef __APPLE__
-#define GL_SILENCE_DEPRECATION
-#include <openGL/gl.h>    // Main OpenGL library
-#include <GLUT/glut.h>    // Second OpenGL library
-#define GLUT_TEXT GLUT_BITMAP_HELVETICA_18
-#endif // __APPLE__
-
-#ifdef __linux__
-#include <GL/gl.h>        // Main OpenGL library
-#include <GL/glut.h>      // Second OpenGL library
-#define GLUT_TEXT GLUT_BITMAP_HELVETICA_12
-#endif // __linux__
-
-#ifdef _WIN32
-#include <stdio.h>
-#include <stdlib.h>
-#include <GL/glut.h>         // OpenGL library we copied 
-#define _USE_MATH_DEFINES
-#include <math.h>
-#define GLUT_TEXT GLUT_BITMAP_HELVETICA_12
-#endif // _WIN32
-
-
-/***************************************************************/
-/***************************************************************/
-/*                             MISC.                           */
-/***************************************************************/
-/***************************************************************/
-
-
-/******************************************************************
- * RANDOM
- * These functions generate a random number.
- ****************************************************************/
-int randomInt(int min, int max)
-{
-   assert(min < max);
-   int num = (rand() % (max - min)) + min;
-   assert(min <= num && num <= max);
-   return num;
-}
-double randomFloat(double min, double max)
-{
-   assert(min <= max);
-   double num = min + ((double)rand() / (double)RAND_MAX * (max - min));
-   assert(min <= num && num <= max);
-   return num;
-}
-
 /***************************************************************/
 /***************************************************************/
 /*                         CONSTRUCTORS                         */
@@ -68,15 +19,17 @@ double randomFloat(double min, double max)
 /******************************************************************
  * STANDARD constructor
  ******************************************************************/
-Standard::Standard(double radius, double speed, int points) : Bird()
+Standard::Standard(const Position & dimensions, Random & random,
+                   double radius, double speed, int points) : Bird()
 {
    // set the position: standard birds start from the middle
-   pt.setY(randomFloat(dimensions.getY() * 0.25, dimensions.getY() * 0.75));
+   pt.setY(random.nextDouble(dimensions.getY() * 0.25, dimensions.getY() * 0.75));
    pt.setX(0.0);
+   ptLast = pt;
 
    // set the velocity
-   v.setDx(randomFloat(speed - 0.5, speed + 0.5));
-   v.setDy(randomFloat(-speed / 5.0, speed / 5.0));
+   v.setDx(random.nextDouble(speed - 0.5, speed + 0.5));
+   v.setDy(random.nextDouble(-speed / 5.0, speed / 5.0));
 
    // set the points
    this->points = points;
@@ -88,15 +41,17 @@ Standard::Standard(double radius, double speed, int points) : Bird()
 /******************************************************************
  * FLOATER constructor
  ******************************************************************/
-Floater::Floater(double radius, double speed, int points) : Bird()
+Floater::Floater(const Position & dimensions, Random & random,
+                 double radius, double speed, int points) : Bird()
 {
    // floaters start on the lower part of the screen because they go up with time
-   pt.setY(randomFloat(dimensions.getY() * 0.01, dimensions.getY() * 0.5));
+   pt.setY(random.nextDouble(dimensions.getY() * 0.01, dimensions.getY() * 0.5));
    pt.setX(0.0);
+   ptLast = pt;
 
    // set the velocity
-   v.setDx(randomFloat(speed - 0.5, speed + 0.5));
-   v.setDy(randomFloat(0.0, speed / 3.0));
+   v.setDx(random.nextDouble(speed - 0.5, speed + 0.5));
+   v.setDy(random.nextDouble(0.0, speed / 3.0));
 
    // set the points value
    this->points = points;
@@ -108,15 +63,17 @@ Floater::Floater(double radius, double speed, int points) : Bird()
 /******************************************************************
  * SINKER constructor
  ******************************************************************/
-Sinker::Sinker(double radius, double speed, int points) : Bird()
+Sinker::Sinker(const Position & dimensions, Random & random,
+               double radius, double speed, int points) : Bird()
 {
    // sinkers start on the upper part of the screen because they go down with time
-   pt.setY(randomFloat(dimensions.getY() * 0.50, dimensions.getY() * 0.95));
+   pt.setY(random.nextDouble(dimensions.getY() * 0.50, dimensions.getY() * 0.95));
    pt.setX(0.0);
+   ptLast = pt;
 
    // set the velocity
-   v.setDx(randomFloat(speed - 0.5, speed + 0.5));
-   v.setDy(randomFloat(-speed / 3.0, 0.0));
+   v.setDx(random.nextDouble(speed - 0.5, speed + 0.5));
+   v.setDy(random.nextDouble(-speed / 3.0, 0.0));
 
    // set the points value
    this->points = points;
@@ -128,15 +85,17 @@ Sinker::Sinker(double radius, double speed, int points) : Bird()
 /******************************************************************
  * CRAZY constructor
  ******************************************************************/
-Crazy::Crazy(double radius, double speed, int points) : Bird()
+Crazy::Crazy(const Position & dimensions, Random & random,
+             double radius, double speed, int points) : Bird()
 {
    // crazy birds start in the middle and can go any which way
-   pt.setY(randomFloat(dimensions.getY() * 0.25, dimensions.getY() * 0.75));
+   pt.setY(random.nextDouble(dimensions.getY() * 0.25, dimensions.getY() * 0.75));
    pt.setX(0.0);
+   ptLast = pt;
 
    // set the velocity
-   v.setDx(randomFloat(speed - 0.5, speed + 0.5));
-   v.setDy(randomFloat(-speed / 5.0, speed / 5.0));
+   v.setDx(random.nextDouble(speed - 0.5, speed + 0.5));
+   v.setDy(random.nextDouble(-speed / 5.0, speed / 5.0));
 
    // set the points value
    this->points = points;
@@ -155,8 +114,11 @@ Crazy::Crazy(double radius, double speed, int points) : Bird()
  * STANDARD ADVANCE
  * How the standard bird moves - inertia and drag
  *********************************************/
-void Standard::advance()
+void Standard::advance(const Position & dimensions, Random & random)
 {
+   // remember where we were for drawing between frames
+   ptLast = pt;
+
    // small amount of drag
    v *= 0.995;
 
@@ -164,7 +126,7 @@ void Standard::advance()
    pt.add(v);
 
    // out of bounds checker
-   if (isOutOfBounds())
+   if (isOutOfBounds(dimensions))
    {
       kill();
       points *= -1; // points go negative when it is missed!
@@ -175,8 +137,11 @@ void Standard::advance()
  * FLOATER ADVANCE
  * How the floating bird moves: strong drag and anti-gravity
  *********************************************/
-void Floater::advance()
+void Floater::advance(const Position & dimensions, Random & random)
 {
+   // remember where we were for drawing between frames
+   ptLast = pt;
+
    // large amount of drag
    v *= 0.990;
 
@@ -187,7 +152,7 @@ void Floater::advance()
    v.addDy(0.05);
 
    // out of bounds checker
-   if (isOutOfBounds())
+   if (isOutOfBounds(dimensions))
    {
       kill();
       points *= -1; // points go negative when it is missed!
@@ -198,20 +163,23 @@ void Floater::advance()
  * CRAZY ADVANCE
  * How the crazy bird moves, every half a second it changes direciton
  *********************************************/
-void Crazy::advance()
+void Crazy::advance(const Position & dimensions, Random & random)
 {
+   // remember where we were for drawing between frames
+   ptLast = pt;
+
    // erratic turns eery half a second or so
-   if (randomInt(0, 15) == 0)
+   if (random.nextInt(0, 15) == 0)
    {
-      v.addDy(randomFloat(-1.5, 1.5));
-      v.addDx(randomFloat(-1.5, 1.5));
+      v.addDy(random.nextDouble(-1.5, 1.5));
+      v.addDx(random.nextDouble(-1.5, 1.5));
    }
 
    // inertia
    pt.add(v);
 
    // out of bounds checker
-   if (isOutOfBounds())
+   if (isOutOfBounds(dimensions))
    {
       kill();
       points *= -1; // points go negative when it is missed!
@@ -222,8 +190,11 @@ void Crazy::advance()
  * SINKER ADVANCE
  * How the sinker bird moves, no drag but gravity
  *********************************************/
-void Sinker::advance()
+void Sinker::advance(const Position & dimensions, Random & random)
 {
+   // remember where we were for drawing between frames
+   ptLast = pt;
+
    // gravity
    v.addDy(-0.07);
 
@@ -231,109 +202,9 @@ void Sinker::advance()
    pt.add(v);
 
    // out of bounds checker
-   if (isOutOfBounds())
+   if (isOutOfBounds(dimensions))
    {
       kill();
       points *= -1; // points go negative when it is missed!
    }
 }
-
-/***************************************************************/
-/***************************************************************/
-/*                             DRAW                            */
-/***************************************************************/
-/***************************************************************/
-
-/************************************************************************
- * DRAW Disk
- * Draw a filled circule at [center] with size [radius]
- *************************************************************************/
-void drawDisk(const Position& center, double radius,
-              double red, double green, double blue)
-{
-   assert(radius > 1.0);
-   const double increment = M_PI / radius;  // bigger the circle, the more increments
-
-   // begin drawing
-   glBegin(GL_TRIANGLES);
-   glColor3f((GLfloat)red /* red % */, (GLfloat)green /* green % */, (GLfloat)blue /* blue % */);
-
-   // three points: center, pt1, pt2
-   Position pt1;
-   pt1.setX(center.getX() + (radius * cos(0.0)));
-   pt1.setY(center.getY() + (radius * sin(0.0)));
-   Position pt2(pt1);
-
-   // go around the circle
-   for (double radians = increment;
-      radians <= M_PI * 2.0 + .5;
-      radians += increment)
-   {
-      pt2.setX(center.getX() + (radius * cos(radians)));
-      pt2.setY(center.getY() + (radius * sin(radians)));
-
-      glVertex2f((GLfloat)center.getX(), (GLfloat)center.getY());
-      glVertex2f((GLfloat)pt1.getX(), (GLfloat)pt1.getY());
-      glVertex2f((GLfloat)pt2.getX(), (GLfloat)pt2.getY());
-
-      pt1 = pt2;
-   }
-
-   // complete drawing
-   glEnd();
-}
-
-/*********************************************
- * STANDARD DRAW
- * Draw a standard bird: blue center and white outline
- *********************************************/
-void Standard::draw()
-{
-   if (!isDead())
-   {
-      drawDisk(pt, radius - 0.0, 1.0, 1.0, 1.0); // white outline
-      drawDisk(pt, radius - 3.0, 0.0, 0.0, 1.0); // blue center
-   }
-}
-
-/*********************************************
- * FLOATER DRAW
- * Draw a floating bird: white center and blue outline
- *********************************************/
-void Floater::draw()
-{
-   if (!isDead())
-   {
-      drawDisk(pt, radius - 0.0, 0.0, 0.0, 1.0); // blue outline
-      drawDisk(pt, radius - 4.0, 1.0, 1.0, 1.0); // white center
-   }
-}
-
-/*********************************************
- * CRAZY DRAW
- * Draw a crazy bird: concentric circles in a course gradient
- *********************************************/
-void Crazy::draw()
-{
-   if (!isDead())
-   {
-      drawDisk(pt, radius * 1.0, 0.0, 0.0, 1.0); // bright blue outside
-      drawDisk(pt, radius * 0.8, 0.2, 0.2, 1.0);
-      drawDisk(pt, radius * 0.6, 0.4, 0.4, 1.0);
-      drawDisk(pt, radius * 0.4, 0.6, 0.6, 1.0);
-      drawDisk(pt, radius * 0.2, 0.8, 0.8, 1.0); // almost white inside
-   }
-}
-
-/*********************************************
- * SINKER DRAW
- * Draw a sinker bird: black center and dark blue outline
- *********************************************/
-void Sinker::draw()
-{
-   if (!isDead())
-   {
-      drawDisk(pt, radius - 0.0, 0.0, 0.0, 0.8);
-      drawDisk(pt, radius - 4.0, 0.0, 0.0, 0.0);
-   }
-}
@@ -9,6 +9,8 @@
 
 #pragma once
 #include "position.h"
+#include "pool.h"
+#include "random.h"
 
 /**********************
  * BIRD
@@ -17,8 +19,8 @@
 class Bird
 {
 protected:
-   static Position dimensions; // size of the screen
    Position pt;                  // position of the flyer
+   Position ptLast;              // position at the start of the frame
    Velocity v;                // velocity of the flyer
    double radius;             // the size (radius) of the flyer
    bool dead;                 // is this flyer dead?
@@ -26,7 +28,8 @@ protected:
    
 public:
    Bird() : dead(false), points(0), radius(1.0) { }
-   
+   virtual ~Bird() {}
+
    // setters
    void operator=(const Position    & rhs) { pt = rhs;    }
    void operator=(const Velocity & rhs) { v = rhs;     }
@@ -36,64 +39,75 @@ public:
    // getters
    bool isDead()           const { return dead;   }
    Position getPosition()     const { return pt;     }
+   Position getLastPosition() const { return ptLast; }
    Velocity getVelocity()  const { return v;      }
    double getRadius()      const { return radius; }
    int getPoints() const { return points; }
-   bool isOutOfBounds() const
+   bool isOutOfBounds(const Position & dimensions) const
    {
       return (pt.getX() < -radius || pt.getX() >= dimensions.getX() + radius ||
               pt.getY() < -radius || pt.getY() >= dimensions.getY() + radius);
    }
 
-   // special functions
-   virtual void draw() = 0;
-   virtual void advance() = 0;
+   // special functions. The screen belongs to the game, not the
+   // birds, so it is handed to each one that needs it. The game calls
+   // each bird as its own kind; this is virtual only so the benchmarks
+   // can compare that with calling through a Bird
+   virtual void advance(const Position & dimensions, Random & random) = 0;
+
+   // does advance() draw random numbers? Those that do have to take
+   // their turn in order; the rest can advance at the same time
+   static const bool drawsRandom = false;
 };
 
 /*********************************************
  * STANDARD
  * A standard bird: slows down, flies in a straight line
  *********************************************/
-class Standard : public Bird
+class Standard final : public Bird
 {
 public:
-    Standard(double radius = 25.0, double speed = 5.0, int points = 10);
-    void draw();
-    void advance();
+    Standard(const Position & dimensions, Random & random,
+             double radius = 25.0, double speed = 5.0, int points = 10);
+    void advance(const Position & dimensions, Random & random);
 };
 
 /*********************************************
  * FLOATER
  * A bird that floats like a balloon: flies up and really slows down
  *********************************************/
-class Floater : public Bird
+class Floater final : public Bird
 {
 public:
-    Floater(double radius = 30.0, double speed = 5.0, int points = 15);
-    void draw();
-    void advance();
+    Floater(const Position & dimensions, Random & random,
+            double radius = 30.0, double speed = 5.0, int points = 15);
+    void advance(const Position & dimensions, Random & random);
 };
 
 /*********************************************
  * CRAZY
  * A crazy flying object: randomly changes direction
  *********************************************/
-class Crazy : public Bird
+class Crazy final : public Bird
 {
 public:
-    Crazy(double radius = 30.0, double speed = 4.5, int points = 30);
-    void draw();
-    void advance();
+    Crazy(const Position & dimensions, Random & random,
+          double radius = 30.0, double speed = 4.5, int points = 30);
+    void advance(const Position & dimensions, Random & random);
+    static const bool drawsRandom = true;
 };
 
 /*********************************************
  * SINKER
  * A sinker bird: honors gravity
  *********************************************/
-class Sinker : public Bird
+class Sinker final : public Bird
 {
 public:
-    Sinker(double radius = 30.0, double speed = 4.5, int points = 20);
-    void draw();
-    void advance();
+    Sinker(const Position & dimensions, Random & random,
+           double radius = 30.0, double speed = 4.5, int points = 20);
+    void advance(const Position & dimensions, Random & random);
 };
+
+// all the birds, side by side in memory
+typedef PolyPool<Bird, Standard, Floater, Crazy, Sinker> BirdPool;
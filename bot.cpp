@@ -0,0 +1,101 @@
+/***********************************************************************
+ * Source File:
+ *    BOT : Something that plays the game instead of a person
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    Bots look at the state of the game and decide which keys to press.
+ *    They let us play thousands of games without a window.
+ ************************************************************************/
+
+#include <cmath>
+#include "bot.h"
+#include "skeet.h"
+
+/*********************************************
+ * RANDOM BOT : PLAY
+ * Hold the arrows for a while, fire now and then
+ *********************************************/
+Input RandomBot::play(const Skeet & skeet)
+{
+   Input input;
+   input.setUp(random.nextInt(0, 2));
+   input.setDown(random.nextInt(0, 2));
+   input.setSpace(random.nextInt(0, 10) == 0);
+   input.setM(random.nextInt(0, 60) == 0);
+   input.setB(random.nextInt(0, 90) == 0);
+   return input;
+}
+
+/*********************************************
+ * AIM BOT : PLAY
+ * Point at the closest bird and shoot it
+ *********************************************/
+Input AimBot::play(const Skeet & skeet)
+{
+   Input input;
+   framesSinceShot++;
+
+   // find the closest bird to the gun
+   Position ptGun = skeet.getGun().getPosition();
+   const Bird * pTarget = nullptr;
+   double distanceMin = 0.0;
+   for (auto & bird : skeet.getBirds())
+   {
+      if (bird.isDead())
+         continue;
+      double dx = ptGun.getX() - bird.getPosition().getX();
+      double dy = bird.getPosition().getY() - ptGun.getY();
+      double distance = dx * dx + dy * dy;
+      if (pTarget == nullptr || distance < distanceMin)
+      {
+         pTarget = &bird;
+         distanceMin = distance;
+      }
+   }
+   if (pTarget == nullptr)
+      return input;
+
+   // lead the bird by how long a pellet takes to get there
+   double frames = sqrt(distanceMin) / 15.0;
+   double x = pTarget->getPosition().getX() + pTarget->getVelocity().getDx() * frames;
+   double y = pTarget->getPosition().getY() + pTarget->getVelocity().getDy() * frames;
+
+   // up turns the gun up, down turns it down
+   double angleWant = atan2(y - ptGun.getY(), ptGun.getX() - x);
+   double angleHave = skeet.getGun().getAngle();
+   if (angleWant > angleHave + 0.02)
+      input.setUp(1);
+   else if (angleWant < angleHave - 0.02)
+      input.setDown(1);
+
+   // fire when lined up
+   else if (framesSinceShot > 4)
+   {
+      int level = skeet.getTime().level();
+      if (level > 2 && framesSinceShot > 60)
+         input.setB(true);
+      else if (level > 1 && framesSinceShot > 30)
+         input.setM(true);
+      else
+         input.setSpace(true);
+      framesSinceShot = 0;
+   }
+
+   return input;
+}
+
+/*********************************************
+ * NEW BOT
+ * Make a bot from its name on the command line
+ *********************************************/
+std::unique_ptr<Bot> newBot(const std::string & name, uint64_t seed)
+{
+   if (name == "aim")
+      return std::unique_ptr<Bot>(new AimBot);
+   if (name == "random")
+      return std::unique_ptr<Bot>(new RandomBot(seed));
+   if (name == "idle")
+      return std::unique_ptr<Bot>(new IdleBot);
+   return nullptr;
+}
@@ -0,0 +1,74 @@
+/***********************************************************************
+ * Header File:
+ *    BOT : Something that plays the game instead of a person
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    Bots look at the state of the game and decide which keys to press.
+ *    They let us play thousands of games without a window.
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "input.h"
+#include "random.h"
+
+class Skeet;
+
+/*********************************************
+ * BOT
+ * Decide what to press this frame
+ *********************************************/
+class Bot
+{
+public:
+   virtual ~Bot() {}
+   virtual Input play(const Skeet & skeet) = 0;
+};
+
+/*********************************************
+ * IDLE BOT
+ * Never touches the keyboard. Every bird escapes.
+ *********************************************/
+class IdleBot : public Bot
+{
+public:
+   Input play(const Skeet & skeet) { return Input(); }
+};
+
+/*********************************************
+ * RANDOM BOT
+ * Mashes the keys
+ *********************************************/
+class RandomBot : public Bot
+{
+public:
+   RandomBot(uint64_t seed = 0) : random(seed) {}
+   Input play(const Skeet & skeet);
+private:
+   Random random;              // the bot's own, so it does not change the game's
+};
+
+/*********************************************
+ * AIM BOT
+ * Turn the gun toward the nearest bird, lead it,
+ * and fire when lined up. Missiles and bombs when allowed.
+ *********************************************/
+class AimBot : public Bot
+{
+public:
+   AimBot() : framesSinceShot(0) {}
+   Input play(const Skeet & skeet);
+private:
+   int framesSinceShot;        // do not waste pellets
+};
+
+// the bots by name, for the command line
+#define BOT_NAMES "aim|random|idle"
+
+// a new bot called [name], or NULL if there is no such bot. [seed] is
+// for the bots that make random choices
+std::unique_ptr<Bot> newBot(const std::string & name, uint64_t seed = 0);
@@ -10,9 +10,19 @@
 #pragma once
 #include "position.h"
 #include "effect.h"
-#include <list>
+#include "pool.h"
+#include "random.h"
 #include <cassert>
 
+class Bullet;
+class Pellet;
+class Bomb;
+class Shrapnel;
+class Missile;
+
+// all the bullets, side by side in memory
+typedef PolyPool<Bullet, Pellet, Bomb, Shrapnel, Missile> BulletPool;
+
 /*********************************************
  * BULLET
  * Something to shoot something else
@@ -20,15 +30,17 @@
 class Bullet
 {
 protected:
-   static Position dimensions;   // size of the screen
    Position pt;                  // position of the bullet
+   Position ptLast;              // position at the start of the frame
    Velocity v;                // velocity of the bullet
    double radius;             // the size (radius) of the bullet
    bool dead;                 // is this bullet dead?
    int value;                 // how many points does this cost?
     
 public:
-   Bullet(double angle = 0.0, double speed = 30.0, double radius = 5.0, int value = 1);
+   Bullet(const Position & dimensions, double angle = 0.0, double speed = 30.0,
+          double radius = 5.0, int value = 1);
+   virtual ~Bullet() {}
    
    // setters
    void kill()                   { dead = true; }
@@ -37,84 +49,82 @@ public:
    // getters
    bool isDead()           const { return dead;   }
    Position getPosition()  const { return pt;     }
+   Position getLastPosition() const { return ptLast; }
    Velocity getVelocity()  const { return v;      }
    double getRadius()      const { return radius; }
    int getValue()          const { return value;  }
 
-   // special functions
-   virtual void death(std::list<Bullet *> & bullets) {}
-   virtual void output() = 0;
-   virtual void input(bool isUp, bool isDown, bool isB) {}
-   virtual void move(std::list<Effect*> &effects);
+   // special functions. The game calls each bullet as its own kind, so
+   // input() need not be virtual. death() is, because the game reaches
+   // the dead by index; move() only so the benchmarks can compare calling
+   // as its own kind with calling through a Bullet
+   virtual void death(BulletPool & bullets, Random & random) {}
+   void input(bool isUp, bool isDown, bool isB) {}
+   virtual void move(const Position & dimensions, Effects & effects);
 
 protected:
-   bool isOutOfBounds() const
+   // for those that do not come out of the gun
+   Bullet() : radius(5.0), dead(false), value(1) {}
+
+   bool isOutOfBounds(const Position & dimensions) const
    {
       return (pt.getX() < -radius || pt.getX() >= dimensions.getX() + radius ||
          pt.getY() < -radius || pt.getY() >= dimensions.getY() + radius);
    }
-   void drawLine(const Position& begin, const Position& end,
-                 double red = 1.0, double green = 1.0, double blue = 1.0) const;
-
-   void drawDot(const Position& point, double radius = 2.0,
-                double red = 1.0, double green = 1.0, double blue = 1.0) const;
-   int    random(int    min, int    max);
-   double random(double min, double max);
 };
 
 /*********************
  * PELLET
  * Small little bullet
  **********************/
-class Pellet : public Bullet
+class Pellet final : public Bullet
 {
 public:
-   Pellet(double angle, double speed = 15.0) : Bullet(angle, speed, 1.0, 1) {}
-   
-   void output();
+   Pellet(const Position & dimensions, double angle, double speed = 15.0) :
+      Bullet(dimensions, angle, speed, 1.0, 1) {}
 };
 
 /*********************
  * BOMB
  * Things that go "boom"
  **********************/
-class Bomb : public Bullet
+class Bomb final : public Bullet
 {
 private:
    int timeToDie;
 public:
-   Bomb(double angle, double speed = 10.0) : Bullet(angle, speed, 4.0, 4), timeToDie(60) {}
+   Bomb(const Position & dimensions, double angle, double speed = 10.0) :
+      Bullet(dimensions, angle, speed, 4.0, 4), timeToDie(60) {}
    
-   void output();
-   void move(std::list<Effect*> & effects);
-   void death(std::list<Bullet *> & bullets);
+   void move(const Position & dimensions, Effects & effects);
+   void death(BulletPool & bullets, Random & random);
 };
 
 /*********************
  * Shrapnel
  * A piece that broke off of a bomb
  **********************/
-class Shrapnel : public Bullet
+class Shrapnel final : public Bullet
 {
 private:
    int timeToDie;
 public:
-   Shrapnel(const Bomb & bomb)
+   Shrapnel(const Bomb & bomb, Random & random)
    {
       // how long will this one live?
-      timeToDie = random(5, 15);
+      timeToDie = random.nextInt(5, 15);
       
       // The speed and direction is random
-      v.set(random(0.0, 6.2), random(10.0, 15.0));
+      v.set(random.nextDouble(0.0, 6.2), random.nextDouble(10.0, 15.0));
       pt = bomb.getPosition();
+      ptLast = pt;
 
       value = 0;
       
       radius = 3.0;
    }
    
-   void output();  
-   void move(std::list<Effect*> & effects);
+   void move(const Position & dimensions, Effects & effects);
 };
 
 
@@ -122,12 +132,12 @@ public:
  * MISSILE
  * Guided missiles
  **********************/
-class Missile : public Bullet
+class Missile final : public Bullet
 {
 public:
-   Missile(double angle, double speed = 10.0) : Bullet(angle, speed, 1.0, 3) {}
+   Missile(const Position & dimensions, double angle, double speed = 10.0) :
+      Bullet(dimensions, angle, speed, 1.0, 3) {}
    
-   void output();
    void input(bool isUp, bool isDown, bool isB)
    {
       if (isUp)
@@ -135,5 +145,5 @@ public:
       if (isDown)
          v.turn(-0.04);
    }
-   void move(std::list<Effect*> & effects);
+   void move(const Position & dimensions, Effects & effects);
 };
@@ -0,0 +1,314 @@
+/***********************************************************************
+ * Source File:
+ *    COLLISION : Test one bullet against many birds at once
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The scalar, SSE2, and AVX2 versions of the bullet-against-birds
+ *    test, and the code to pick between them.
+ ************************************************************************/
+
+#include <cassert>
+#include "collision.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define COLLISION_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define TARGET_SSE2
+#define TARGET_AVX2
+#else
+#define TARGET_SSE2 __attribute__((target("sse2")))  // 32-bit builds may not have it
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif // x86
+
+#define LANES 4      // the widest kernel tests four birds at a time
+
+/***************************************************************/
+/***************************************************************/
+/*                             ISA                             */
+/***************************************************************/
+/***************************************************************/
+
+/*********************************************
+ * IS SUPPORTED
+ * Can this processor run the given instructions?
+ *********************************************/
+bool isSupported(Isa isa)
+{
+   switch (isa)
+   {
+      case ISA_SCALAR:
+         return true;
+#ifdef COLLISION_X86
+#ifdef _MSC_VER
+      case ISA_SSE2:
+      {
+         int info[4];
+         __cpuid(info, 1);
+         return (info[3] & (1 << 26)) != 0;
+      }
+      case ISA_AVX2:
+      {
+         int info[4];
+         __cpuid(info, 1);
+         bool osSavesYmm = (info[2] & (1 << 27)) && (_xgetbv(0) & 0x6) == 0x6;
+         __cpuidex(info, 7, 0);
+         return osSavesYmm && (info[1] & (1 << 5)) != 0;
+      }
+#else
+      case ISA_SSE2:
+         return __builtin_cpu_supports("sse2");
+      case ISA_AVX2:
+         return __builtin_cpu_supports("avx2");
+#endif // _MSC_VER
+#endif // COLLISION_X86
+      default:
+         return false;
+   }
+}
+
+/*********************************************
+ * BEST ISA
+ * The widest instructions this processor can run
+ *********************************************/
+Isa bestIsa()
+{
+   static const Isa best = isSupported(ISA_AVX2) ? ISA_AVX2 :
+                           isSupported(ISA_SSE2) ? ISA_SSE2 : ISA_SCALAR;
+   return best;
+}
+
+/*********************************************
+ * GET NAME
+ *********************************************/
+const char * getName(Isa isa)
+{
+   switch (isa)
+   {
+      case ISA_SCALAR:
+         return "scalar";
+      case ISA_SSE2:
+         return "sse2";
+      case ISA_AVX2:
+         return "avx2";
+   }
+   return "unknown";
+}
+
+/***************************************************************/
+/***************************************************************/
+/*                           KERNELS                           */
+/***************************************************************/
+/***************************************************************/
+
+/*********************************************
+ * COLLIDE SCALAR
+ * One bird at a time, straight through timeOfImpact()
+ *********************************************/
+static void collideScalar(const double * x, const double * y,
+                          const double * dx, const double * dy,
+                          const double * radius, size_t numBirds,
+                          const Position & pt, const Velocity & v, double r,
+                          std::vector<int> & hits)
+{
+   double time;
+   for (size_t i = 0; i < numBirds; i++)
+      if (timeOfImpact(Position(x[i], y[i]), Velocity(dx[i], dy[i]), pt, v,
+                       radius[i] + r, time))
+         hits.push_back((int)i);
+}
+
+#ifdef COLLISION_X86
+
+/*********************************************
+ * COLLIDE SSE2
+ * Two birds at a time. Each step is the same as
+ * timeOfImpact(); the comparisons are the "not" forms
+ * so a NaN goes the same way it does there.
+ *********************************************/
+TARGET_SSE2
+static void collideSse2(const double * x, const double * y,
+                        const double * dx, const double * dy,
+                        const double * radius, size_t numBirds,
+                        const Position & pt, const Velocity & v, double r,
+                        std::vector<int> & hits)
+{
+   const __m128d ptX  = _mm_set1_pd(pt.getX());
+   const __m128d ptY  = _mm_set1_pd(pt.getY());
+   const __m128d vDx  = _mm_set1_pd(v.getDx());
+   const __m128d vDy  = _mm_set1_pd(v.getDy());
+   const __m128d rad  = _mm_set1_pd(r);
+   const __m128d zero = _mm_setzero_pd();
+   const __m128d one  = _mm_set1_pd(1.0);
+   const __m128d sign = _mm_set1_pd(-0.0);
+
+   for (size_t i = 0; i < numBirds; i += 2)
+   {
+      // where the bird is relative to the bullet
+      __m128d relX = _mm_sub_pd(_mm_loadu_pd(x + i),  ptX);
+      __m128d relY = _mm_sub_pd(_mm_loadu_pd(y + i),  ptY);
+      __m128d wX   = _mm_sub_pd(_mm_loadu_pd(dx + i), vDx);
+      __m128d wY   = _mm_sub_pd(_mm_loadu_pd(dy + i), vDy);
+      __m128d dist = _mm_add_pd(_mm_loadu_pd(radius + i), rad);
+
+      __m128d dd = _mm_add_pd(_mm_mul_pd(relX, relX), _mm_mul_pd(relY, relY));
+      __m128d dw = _mm_add_pd(_mm_mul_pd(relX, wX),   _mm_mul_pd(relY, wY));
+      __m128d ww = _mm_add_pd(_mm_mul_pd(wX, wX),     _mm_mul_pd(wY, wY));
+      __m128d rr = _mm_mul_pd(dist, dist);
+
+      // closest point of the frame
+      __m128d t = _mm_min_pd(one, _mm_div_pd(_mm_xor_pd(dw, sign), ww));
+      __m128d cX = _mm_add_pd(relX, _mm_mul_pd(wX, t));
+      __m128d cY = _mm_add_pd(relY, _mm_mul_pd(wY, t));
+      __m128d cc = _mm_add_pd(_mm_mul_pd(cX, cX), _mm_mul_pd(cY, cY));
+
+      // touching now, or closing and close enough
+      __m128d hit = _mm_or_pd(_mm_cmplt_pd(dd, rr),
+                              _mm_and_pd(_mm_and_pd(_mm_cmpnge_pd(dw, zero),
+                                                    _mm_cmpneq_pd(ww, zero)),
+                                         _mm_cmpnge_pd(cc, rr)));
+
+      int mask = _mm_movemask_pd(hit);
+      for (size_t lane = 0; mask; lane++, mask >>= 1)
+         if ((mask & 1) && i + lane < numBirds)
+            hits.push_back((int)(i + lane));
+   }
+}
+
+/*********************************************
+ * COLLIDE AVX2
+ * Four birds at a time, otherwise the same as SSE2
+ *********************************************/
+TARGET_AVX2
+static void collideAvx2(const double * x, const double * y,
+                        const double * dx, const double * dy,
+                        const double * radius, size_t numBirds,
+                        const Position & pt, const Velocity & v, double r,
+                        std::vector<int> & hits)
+{
+   const __m256d ptX  = _mm256_set1_pd(pt.getX());
+   const __m256d ptY  = _mm256_set1_pd(pt.getY());
+   const __m256d vDx  = _mm256_set1_pd(v.getDx());
+   const __m256d vDy  = _mm256_set1_pd(v.getDy());
+   const __m256d rad  = _mm256_set1_pd(r);
+   const __m256d zero = _mm256_setzero_pd();
+   const __m256d one  = _mm256_set1_pd(1.0);
+   const __m256d sign = _mm256_set1_pd(-0.0);
+
+   for (size_t i = 0; i < numBirds; i += 4)
+   {
+      // where the bird is relative to the bullet
+      __m256d relX = _mm256_sub_pd(_mm256_loadu_pd(x + i),  ptX);
+      __m256d relY = _mm256_sub_pd(_mm256_loadu_pd(y + i),  ptY);
+      __m256d wX   = _mm256_sub_pd(_mm256_loadu_pd(dx + i), vDx);
+      __m256d wY   = _mm256_sub_pd(_mm256_loadu_pd(dy + i), vDy);
+      __m256d dist = _mm256_add_pd(_mm256_loadu_pd(radius + i), rad);
+
+      __m256d dd = _mm256_add_pd(_mm256_mul_pd(relX, relX), _mm256_mul_pd(relY, relY));
+      __m256d dw = _mm256_add_pd(_mm256_mul_pd(relX, wX),   _mm256_mul_pd(relY, wY));
+      __m256d ww = _mm256_add_pd(_mm256_mul_pd(wX, wX),     _mm256_mul_pd(wY, wY));
+      __m256d rr = _mm256_mul_pd(dist, dist);
+
+      // closest point of the frame
+      __m256d t = _mm256_min_pd(one, _mm256_div_pd(_mm256_xor_pd(dw, sign), ww));
+      __m256d cX = _mm256_add_pd(relX, _mm256_mul_pd(wX, t));
+      __m256d cY = _mm256_add_pd(relY, _mm256_mul_pd(wY, t));
+      __m256d cc = _mm256_add_pd(_mm256_mul_pd(cX, cX), _mm256_mul_pd(cY, cY));
+
+      // touching now, or closing and close enough
+      __m256d hit = _mm256_or_pd(_mm256_cmp_pd(dd, rr, _CMP_LT_OQ),
+                                 _mm256_and_pd(_mm256_and_pd(_mm256_cmp_pd(dw, zero, _CMP_NGE_UQ),
+                                                             _mm256_cmp_pd(ww, zero, _CMP_NEQ_UQ)),
+                                               _mm256_cmp_pd(cc, rr, _CMP_NGE_UQ)));
+
+      int mask = _mm256_movemask_pd(hit);
+      for (size_t lane = 0; mask; lane++, mask >>= 1)
+         if ((mask & 1) && i + lane < numBirds)
+            hits.push_back((int)(i + lane));
+   }
+}
+
+#endif // COLLISION_X86
+
+/***************************************************************/
+/***************************************************************/
+/*                          BIRD BLOCK                         */
+/***************************************************************/
+/***************************************************************/
+
+/*********************************************
+ * BIRD BLOCK : SET ISA
+ *********************************************/
+void BirdBlock::setIsa(Isa isa)
+{
+   assert(isSupported(isa));
+   this->isa = isa;
+}
+
+/*********************************************
+ * BIRD BLOCK : CLEAR
+ *********************************************/
+void BirdBlock::clear()
+{
+   numBirds = 0;
+   x.clear();
+   y.clear();
+   dx.clear();
+   dy.clear();
+   radius.clear();
+}
+
+/*********************************************
+ * BIRD BLOCK : ADD
+ * Pack one more bird. Grow all the arrays a full
+ * set of lanes at a time so the kernels can always
+ * read LANES slots.
+ *********************************************/
+void BirdBlock::add(const Position & pt, const Velocity & v, double radius)
+{
+   if (numBirds == x.size())
+   {
+      size_t size = numBirds + LANES;
+      x.resize(size, 0.0);
+      y.resize(size, 0.0);
+      dx.resize(size, 0.0);
+      dy.resize(size, 0.0);
+      this->radius.resize(size, 0.0);
+   }
+
+   x[numBirds]  = pt.getX();
+   y[numBirds]  = pt.getY();
+   dx[numBirds] = v.getDx();
+   dy[numBirds] = v.getDy();
+   this->radius[numBirds] = radius;
+   numBirds++;
+}
+
+/*********************************************
+ * BIRD BLOCK : COLLIDE
+ * Hand the block to the kernel we picked
+ *********************************************/
+void BirdBlock::collide(const Position & pt, const Velocity & v, double radius,
+                        std::vector<int> & hits) const
+{
+   switch (isa)
+   {
+#ifdef COLLISION_X86
+      case ISA_AVX2:
+         collideAvx2(x.data(), y.data(), dx.data(), dy.data(), this->radius.data(),
+                     numBirds, pt, v, radius, hits);
+         break;
+      case ISA_SSE2:
+         collideSse2(x.data(), y.data(), dx.data(), dy.data(), this->radius.data(),
+                     numBirds, pt, v, radius, hits);
+         break;
+#endif // COLLISION_X86
+      default:
+         collideScalar(x.data(), y.data(), dx.data(), dy.data(), this->radius.data(),
+                       numBirds, pt, v, radius, hits);
+         break;
+   }
+}
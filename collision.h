@@ -0,0 +1,73 @@
+/***********************************************************************
+ * Header File:
+ *    COLLISION : Test one bullet against many birds at once
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The birds are packed into a BirdBlock: one array each for x, y, dx,
+ *    dy, and radius. A bullet is then tested against the whole block
+ *    with SSE2 or AVX2, two or four birds at a time, picked when the
+ *    program starts based on what the processor can do. There is always
+ *    a plain scalar version to fall back on.
+ *
+ *    Every version does exactly the arithmetic timeOfImpact() does, in
+ *    the same order, so they all agree with it to the last bit.
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include "position.h"
+
+/**********************
+ * ISA
+ * Which instructions to test the birds with
+ **********************/
+enum Isa { ISA_SCALAR, ISA_SSE2, ISA_AVX2 };
+
+// can this processor run it?
+bool isSupported(Isa isa);
+
+// the fastest one this processor can run
+Isa bestIsa();
+
+// for reports
+const char * getName(Isa isa);
+
+/*********************************************
+ * BIRD BLOCK
+ * The birds of a frame, laid out so a bullet can be
+ * tested against several of them at once
+ *********************************************/
+class BirdBlock
+{
+public:
+   BirdBlock() : isa(bestIsa()) {}
+
+   // which instructions to use. Must be supported.
+   void setIsa(Isa isa);
+   Isa getIsa() const { return isa; }
+
+   // empty the block for a new frame. Keeps its memory.
+   void clear();
+
+   // pack a bird into the next slot
+   void add(const Position & pt, const Velocity & v, double radius);
+
+   // how many birds are in the block
+   size_t size() const { return numBirds; }
+
+   // add to [hits] the slot of every bird this bullet touches this
+   // frame, in increasing order
+   void collide(const Position & pt, const Velocity & v, double radius,
+                std::vector<int> & hits) const;
+
+private:
+   Isa isa;
+   size_t numBirds = 0;
+   std::vector<double> x;        // every array is padded to a multiple
+   std::vector<double> y;        //    of four slots so the kernels never
+   std::vector<double> dx;       //    read past the end. Hits in the
+   std::vector<double> dy;       //    padding are ignored
+   std::vector<double> radius;
+};
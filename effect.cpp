@@ -1,216 +1,313 @@
 /***********************************************************************
  * Source File:
- *    Fragment : Pieces that fly off a dead bird
+ *    Effect : The particles that fly off dead birds and moving bullets
  * Author:
  *    Br. Helfrich
  * Summary:
- *    Pieces that fly off a dead bird
+ *    Adding, moving, and dropping fragments, streeks, and exhaust
  ************************************************************************/
 
+#include <algorithm>
 #include "effect.h"
-#include <cassert>
+#include "jobs.h"
 
-#ifdef __APPLE__
-#define GL_SILENCE_DEPRECATION
-#include <openGL/gl.h>    // Main OpenGL library
-#include <GLUT/glut.h>    // Second OpenGL library
-#define GLUT_TEXT GLUT_BITMAP_HELVETICA_18
-#endif // __APPLE__
+/***************************************************************/
+/***************************************************************/
+/*                         FRAGMENTS                           */
+/***************************************************************/
+/***************************************************************/
+
+/************************************************************************
+ * FRAGMENTS constructor
+ *************************************************************************/
+Fragments::Fragments(size_t capacity)
+{
+   x.reserve(capacity);
+   y.reserve(capacity);
+   xLast.reserve(capacity);
+   yLast.reserve(capacity);
+   dx.reserve(capacity);
+   dy.reserve(capacity);
+   age.reserve(capacity);
+   size_.reserve(capacity);
+}
+
+/************************************************************************
+ * FRAGMENTS ADD
+ *************************************************************************/
+void Fragments::add(const Position & pt, const Velocity & v, Random & random)
+{
+   x.push_back(pt.getX());
+   y.push_back(pt.getY());
+   xLast.push_back(pt.getX());
+   yLast.push_back(pt.getY());
 
-#ifdef __linux__
-#include <GL/gl.h>        // Main OpenGL library
-#include <GL/glut.h>      // Second OpenGL library
-#define GLUT_TEXT GLUT_BITMAP_HELVETICA_12
-#endif // __linux__
+   // the velocity is a random kick plus the velocity of the thing that died
+   dx.push_back(v.getDx() * 0.5 + random.nextDouble(-6.0, 6.0));
+   dy.push_back(v.getDy() * 0.5 + random.nextDouble(-6.0, 6.0));
+
+   // age
+   age.push_back(random.nextDouble(0.4, 1.0));
 
-#ifdef _WIN32
-#include <stdio.h>
-#include <stdlib.h>
-#include <GL/glut.h>         // OpenGL library we copied
-#define _USE_MATH_DEFINES
-#include <math.h>
-#define GLUT_TEXT GLUT_BITMAP_HELVETICA_12
-#endif // _WIN32
+   // size
+   size_.push_back(random.nextDouble(1.0, 2.5));
+}
 
-/******************************************************************
- * RANDOM
- * This function generates a random number.
- ****************************************************************/
-double random(double min, double max)
+/************************************************************************
+ * FRAGMENTS APPEND
+ *************************************************************************/
+void Fragments::append(const Fragments & rhs)
 {
-   assert(min <= max);
-   double num = min + ((double)rand() / (double)RAND_MAX * (max - min));
-   assert(min <= num && num <= max);
-   return num;
+   x.insert(x.end(), rhs.x.begin(), rhs.x.end());
+   y.insert(y.end(), rhs.y.begin(), rhs.y.end());
+   xLast.insert(xLast.end(), rhs.xLast.begin(), rhs.xLast.end());
+   yLast.insert(yLast.end(), rhs.yLast.begin(), rhs.yLast.end());
+   dx.insert(dx.end(), rhs.dx.begin(), rhs.dx.end());
+   dy.insert(dy.end(), rhs.dy.begin(), rhs.dy.end());
+   age.insert(age.end(), rhs.age.begin(), rhs.age.end());
+   size_.insert(size_.end(), rhs.size_.begin(), rhs.size_.end());
 }
 
+/************************************************************************
+ * FRAGMENTS FLY
+ * Each chunk flies on its own and packs its survivors at its
+ * start. Then the chunks slide down one after the other so
+ * the survivors end up side by side, in order.
+ *************************************************************************/
+void Fragments::fly(JobSystem * jobs, size_t grain)
+{
+   if (!jobs || x.size() <= grain)
+   {
+      resize(flyRange(0, x.size()));
+      return;
+   }
 
+   liveInChunk.resize((x.size() + grain - 1) / grain);
+   jobs->parallelFor(x.size(), grain, [this](size_t chunk, size_t begin, size_t end)
+   {
+      liveInChunk[chunk] = flyRange(begin, end);
+   });
 
-/***************************************************************/
-/***************************************************************/
-/*                       CONSTRUCTORS                          */
-/***************************************************************/
-/***************************************************************/
+   size_t live = 0;
+   for (size_t chunk = 0; chunk < liveInChunk.size(); chunk++)
+   {
+      slide(chunk * grain, liveInChunk[chunk], live);
+      live += liveInChunk[chunk];
+   }
+   resize(live);
+}
 
 /************************************************************************
- * FRAGMENT constructor
+ * FRAGMENTS FLY RANGE
+ * Move the fragments in [begin, end), then slide the survivors
+ * down over the dead so they stay in order. Returns how many
+ * survived; they now start at [begin].
  *************************************************************************/
-Fragment::Fragment(const Position & pt, const Velocity & v) : Effect(pt)
+size_t Fragments::flyRange(size_t begin, size_t end)
 {
-   // the velocity is a random kick plus the velocity of the thing that died
-   this->v.setDx(v.getDx() * 0.5 + random(-6.0, 6.0));
-   this->v.setDy(v.getDy() * 0.5 + random(-6.0, 6.0));
-   
-    // age
-    age = random(0.4, 1.0);
-    
-    // size
-    size = random(1.0, 2.5);
+   size_t live = begin;
+   for (size_t i = begin; i < end; i++)
+   {
+      // increase the age so it fades away
+      double ageNew = age[i] - 0.02;
+      if (ageNew <= 0.0)
+         continue;
+
+      // move it forward with inertia (no gravity)
+      xLast[live] = x[i];
+      yLast[live] = y[i];
+      x[live]     = x[i] + dx[i];
+      y[live]     = y[i] + dy[i];
+      dx[live]    = dx[i];
+      dy[live]    = dy[i];
+      age[live]   = ageNew;
+      size_[live] = size_[i] * 0.95;
+      live++;
+   }
+   return live - begin;
 }
 
 /************************************************************************
- * STREEK constructor
+ * FRAGMENTS SLIDE
+ * Move [count] fragments starting at [from] down to [to]
  *************************************************************************/
-Streek::Streek(const Position & pt, Velocity v) : Effect(pt)
+void Fragments::slide(size_t from, size_t count, size_t to)
 {
-   ptEnd = pt;
-   v *= -1.0;
-   ptEnd += v;
-   
-    // age
-    age = 0.5;
+   if (from == to)
+      return;
+   std::copy(x.begin()     + from, x.begin()     + from + count, x.begin()     + to);
+   std::copy(y.begin()     + from, y.begin()     + from + count, y.begin()     + to);
+   std::copy(xLast.begin() + from, xLast.begin() + from + count, xLast.begin() + to);
+   std::copy(yLast.begin() + from, yLast.begin() + from + count, yLast.begin() + to);
+   std::copy(dx.begin()    + from, dx.begin()    + from + count, dx.begin()    + to);
+   std::copy(dy.begin()    + from, dy.begin()    + from + count, dy.begin()    + to);
+   std::copy(age.begin()   + from, age.begin()   + from + count, age.begin()   + to);
+   std::copy(size_.begin() + from, size_.begin() + from + count, size_.begin() + to);
 }
 
 /************************************************************************
- * EXHAUST constructor
+ * FRAGMENTS RESIZE
  *************************************************************************/
-Exhaust::Exhaust(const Position & pt, Velocity v) : Effect(pt)
+void Fragments::resize(size_t count)
 {
-    ptEnd = pt;
-    v *= -1.0;
-    ptEnd += v;
+   x.resize(count);
+   y.resize(count);
+   xLast.resize(count);
+   yLast.resize(count);
+   dx.resize(count);
+   dy.resize(count);
+   age.resize(count);
+   size_.resize(count);
+}
 
-    // age
-    age = 0.5;
+/************************************************************************
+ * FRAGMENTS CLEAR
+ *************************************************************************/
+void Fragments::clear()
+{
+   x.clear();
+   y.clear();
+   xLast.clear();
+   yLast.clear();
+   dx.clear();
+   dy.clear();
+   age.clear();
+   size_.clear();
+}
+
+/************************************************************************
+ * FRAGMENTS BYTES
+ *************************************************************************/
+size_t Fragments::bytes() const
+{
+   return (x.capacity() + y.capacity() + xLast.capacity() + yLast.capacity() +
+           dx.capacity() + dy.capacity() + age.capacity() + size_.capacity()) * sizeof(double);
 }
 
 /***************************************************************/
 /***************************************************************/
-/*                           RENDER                            */
+/*                           TRAILS                            */
 /***************************************************************/
 /***************************************************************/
 
 /************************************************************************
- * FRAGMENT RENDER
- * Draw the fragment on the screen
+ * TRAILS constructor
  *************************************************************************/
-void Fragment::render() const
+Trails::Trails(double fade, size_t capacity) : fade(fade)
 {
-    // Do nothing if we are already dead
-    if (isDead())
-        return;
-    
-    // Draw this sucker
-    glBegin(GL_TRIANGLE_FAN);
-    
-    // the color is a function of age - fading to black
-    glColor3f((GLfloat)age, (GLfloat)age, (GLfloat)age);
-    
-    // draw the fragment
-    glVertex2f((GLfloat)(pt.getX() - size), (GLfloat)(pt.getY() - size));
-    glVertex2f((GLfloat)(pt.getX() + size), (GLfloat)(pt.getY() - size));
-    glVertex2f((GLfloat)(pt.getX() + size), (GLfloat)(pt.getY() + size));
-    glVertex2f((GLfloat)(pt.getX() - size), (GLfloat)(pt.getY() + size));
-    glColor3f((GLfloat)1.0 /* red % */, (GLfloat)1.0 /* green % */, (GLfloat)1.0 /* blue % */);
-    glEnd();
+   x.reserve(capacity);
+   y.reserve(capacity);
+   xEnd.reserve(capacity);
+   yEnd.reserve(capacity);
+   age.reserve(capacity);
 }
 
 /************************************************************************
- * STREEK RENDER
- * Draw the shrapnel streek on the screen
+ * TRAILS ADD
+ * The trail reaches back one frame of the bullet's travel
  *************************************************************************/
-void Streek::render() const
+void Trails::add(const Position & pt, const Velocity & v)
 {
-    // Do nothing if we are already dead
-    if (isDead())
-        return;
-    
-    // Draw this sucker
-    glBegin(GL_LINES);
-    glColor3f((GLfloat)age, (GLfloat)age, (GLfloat)age);
-
-    // Draw the actual line
-    glVertex2f((GLfloat)pt.getX(), (GLfloat)pt.getY());
-    glVertex2f((GLfloat)ptEnd.getX(), (GLfloat)ptEnd.getY());
+   x.push_back(pt.getX());
+   y.push_back(pt.getY());
+   xEnd.push_back(pt.getX() + v.getDx() * -1.0);
+   yEnd.push_back(pt.getY() + v.getDy() * -1.0);
+   age.push_back(0.5);
+}
 
-    glColor3f((GLfloat)1.0 /* red % */, (GLfloat)1.0 /* green % */, (GLfloat)1.0 /* blue % */);
-    glEnd();
+/************************************************************************
+ * TRAILS APPEND
+ *************************************************************************/
+void Trails::append(const Trails & rhs)
+{
+   x.insert(x.end(), rhs.x.begin(), rhs.x.end());
+   y.insert(y.end(), rhs.y.begin(), rhs.y.end());
+   xEnd.insert(xEnd.end(), rhs.xEnd.begin(), rhs.xEnd.end());
+   yEnd.insert(yEnd.end(), rhs.yEnd.begin(), rhs.yEnd.end());
+   age.insert(age.end(), rhs.age.begin(), rhs.age.end());
 }
 
 /************************************************************************
- * EXHAUST RENDER
- * Draw a missile exhaust on the screen
+ * TRAILS FLY
+ * A trail does not move, it just fades away
  *************************************************************************/
-void Exhaust::render() const
+void Trails::fly()
 {
-   // Do nothing if we are already dead
-   if (isDead())
-       return;
-   
-   // Draw this sucker
-   glBegin(GL_LINES);
-   glColor3f((GLfloat)age, (GLfloat)age, (GLfloat)age);
+   size_t live = 0;
+   for (size_t i = 0; i < x.size(); i++)
+   {
+      double ageNew = age[i] - fade;
+      if (ageNew <= 0.0)
+         continue;
 
-   // Draw the actual line
-   glVertex2f((GLfloat)pt.getX(), (GLfloat)pt.getY());
-   glVertex2f((GLfloat)ptEnd.getX(), (GLfloat)ptEnd.getY());
+      x[live]    = x[i];
+      y[live]    = y[i];
+      xEnd[live] = xEnd[i];
+      yEnd[live] = yEnd[i];
+      age[live]  = ageNew;
+      live++;
+   }
 
-   glColor3f((GLfloat)1.0 /* red % */, (GLfloat)1.0 /* green % */, (GLfloat)1.0 /* blue % */);
-   glEnd();
+   x.resize(live);
+   y.resize(live);
+   xEnd.resize(live);
+   yEnd.resize(live);
+   age.resize(live);
+}
+
+/************************************************************************
+ * TRAILS CLEAR
+ *************************************************************************/
+void Trails::clear()
+{
+   x.clear();
+   y.clear();
+   xEnd.clear();
+   yEnd.clear();
+   age.clear();
+}
+
+/************************************************************************
+ * TRAILS BYTES
+ *************************************************************************/
+size_t Trails::bytes() const
+{
+   return (x.capacity() + y.capacity() + xEnd.capacity() + yEnd.capacity() +
+           age.capacity()) * sizeof(double);
 }
 
 /***************************************************************/
 /***************************************************************/
-/*                            FLY                              */
+/*                           EFFECTS                           */
 /***************************************************************/
 /***************************************************************/
 
 /************************************************************************
- * FRAGMENT FLY
- * Move the fragment on the screen
+ * EFFECTS FLY
  *************************************************************************/
-void Fragment :: fly()
+void Effects::fly(JobSystem * jobs, size_t grain)
 {
-    // move it forward with inertia (no gravity)
-    pt += v;
-    
-    // increase the age so it fades away
-    age -= 0.02;
-    size *= 0.95;
+   fragments.fly(jobs, grain);
+   streeks.fly();
+   exhaust.fly();
 }
 
 /************************************************************************
- * STREEK FLY
- * The streek will just fade away
+ * EFFECTS APPEND
  *************************************************************************/
-void Streek :: fly()
+void Effects::append(const Effects & rhs)
 {
-    // move it forward with inertia (no gravity)
-//    pt += v;
-    
-   // increase the age so it fades away
-   age -= 0.10;
+   fragments.append(rhs.fragments);
+   streeks.append(rhs.streeks);
+   exhaust.append(rhs.exhaust);
 }
 
 /************************************************************************
- * EXHAUST FLY
- * The exhaust will just fade away
+ * EFFECTS CLEAR
  *************************************************************************/
-void Exhaust :: fly()
+void Effects::clear()
 {
-   // move it forward with inertia (no gravity)
-//   pt += v;
-    
-   // increase the age so it fades away
-   age -= 0.025;
+   fragments.clear();
+   streeks.clear();
+   exhaust.clear();
 }
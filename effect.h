@@ -1,91 +1,150 @@
 /***********************************************************************
  * Header File:
- *    Fragment : Pieces that fly off a dead bird
+ *    Effect : The particles that fly off dead birds and moving bullets
  * Author:
  *    Br. Helfrich
  * Summary:
- *    Pieces that fly off a dead bird
+ *    Fragments fly off a dead bird, streeks trail off shrapnel, and
+ *    exhaust comes out the back of a missile. There are a lot of them
+ *    and none of them interact with anything, so rather than being
+ *    objects each kind is a set of arrays (one for x, one for y, one
+ *    for age, ...) that are all moved in one pass. A particle that dies
+ *    is dropped in that same pass, so the cost of the effects follows
+ *    the number of live particles.
  ************************************************************************/
 
 #pragma once
+
+#include <cstddef>
+#include <vector>
 #include "position.h"
+#include "random.h"
 
-/**********************
- * Effect: stuff that is not interactive
- **********************/
-class Effect
-{
-protected:
-    Position pt;      // location of the effect
-    double age;    // 1.0 = new, 0.0 = dead
-public:
-    // create a fragment based on the velocity and position of the bullet
-    Effect(const Position & pt) : pt(pt), age(0.5) {}
-    
-    // draw it
-    virtual void render() const = 0;
-    
-    // move it forward with regards to inertia. Let it age
-    virtual void fly() = 0;
-    
-    // it is dead when age goes to 0.0
-    bool isDead() const { return age <= 0.0; }
-};
+class JobSystem;
 
 /**********************
- * FRAGMENT
+ * FRAGMENTS
  * Pieces that fly off a dead bird
  **********************/
-class Fragment : public Effect
+class Fragments
 {
-private:
-   Velocity v;    // direction the fragment is flying
-   double size;   // size of the fragment
 public:
-    // create a fragment based on the velocity and position of the bullet
-    Fragment(const Position & pt, const Velocity & v);
-    
-    // draw it
-    void render() const;
-    
-    // move it forward with regards to inertia. Let it age
-    void fly();
+   Fragments(size_t capacity = 0);
+
+   // a new fragment kicked off the velocity of the bullet
+   void add(const Position & pt, const Velocity & v, Random & random);
+
+   // all of [rhs]'s fragments, after ours
+   void append(const Fragments & rhs);
+
+   // move every fragment forward with inertia, let it age, and drop
+   // the ones that are dead. With [jobs], chunks of [grain] fragments
+   // fly at the same time; the survivors are the same either way
+   void fly(JobSystem * jobs = NULL, size_t grain = 0);
+
+   // remove everything but keep the memory
+   void clear();
+
+   // getters
+   size_t size()            const { return x.size(); }
+   size_t bytes()           const;
+   Position getPosition(size_t i) const { return Position(x[i], y[i]); }
+   Position getLastPosition(size_t i) const { return Position(xLast[i], yLast[i]); }
+   double getAge(size_t i)  const { return age[i];  }
+   double getSize(size_t i) const { return size_[i]; }
+
+private:
+   size_t flyRange(size_t begin, size_t end);
+   void slide(size_t from, size_t count, size_t to);
+   void resize(size_t count);
+
+   std::vector<size_t> liveInChunk;  // survivors of each chunk, when in parallel
+   std::vector<double> x;         // location of each fragment
+   std::vector<double> y;
+   std::vector<double> xLast;     // location at the start of the frame
+   std::vector<double> yLast;
+   std::vector<double> dx;        // direction each fragment is flying
+   std::vector<double> dy;
+   std::vector<double> age;       // 1.0 = new, 0.0 = dead
+   std::vector<double> size_;     // size of each fragment
 };
 
 /**********************
- * STREEK
- * Stuff that trails off the back of shrapnel
+ * TRAILS
+ * Lines that sit still and fade away: the streeks off the
+ * back of shrapnel and the exhaust out the back of a missile
  **********************/
-class Streek : public Effect
+class Trails
 {
-private:
-   Position ptEnd;
 public:
-    // create a fragment based on the velocity and position of the bullet
-    Streek(const Position & pt, Velocity v);
-    
-    // draw it
-    void render() const;
-    
-    // move it forward with regards to inertia. Let it age
-    void fly();
+   Trails(double fade, size_t capacity = 0);
+
+   // a new trail from where the bullet is to where it was
+   void add(const Position & pt, const Velocity & v);
+
+   // all of [rhs]'s trails, after ours
+   void append(const Trails & rhs);
+
+   // let every trail age and drop the ones that are dead
+   void fly();
+
+   // remove everything but keep the memory
+   void clear();
+
+   // getters
+   size_t size()                  const { return x.size(); }
+   size_t bytes()                 const;
+   Position getPosition(size_t i) const { return Position(x[i], y[i]);       }
+   Position getEnd(size_t i)      const { return Position(xEnd[i], yEnd[i]); }
+   double getAge(size_t i)        const { return age[i]; }
+
+private:
+   double fade;                   // how much age is lost every frame
+   std::vector<double> x;         // the front of each trail
+   std::vector<double> y;
+   std::vector<double> xEnd;      // the back of each trail
+   std::vector<double> yEnd;
+   std::vector<double> age;       // 0.5 = new, 0.0 = dead
 };
 
 /**********************
- * EXHAUST
- * Stuff that comes out the back of a missile when in flight
+ * EFFECTS
+ * Every particle in the game
  **********************/
-class Exhaust : public Effect
+class Effects
 {
-private:
-   Position ptEnd;
 public:
-    // create a fragment based on the velocity and position of the bullet
-    Exhaust(const Position & pt, Velocity v);
-    
-    // draw it
-    void render() const;
-    
-    // move it forward with regards to inertia. Let it age
-    void fly();
+   Effects(size_t capacity = 0) : fragments(capacity),
+                                  streeks(0.10, capacity / 8),
+                                  exhaust(0.025, capacity / 8) {}
+
+   // add one of each kind
+   void addFragment(const Position & pt, const Velocity & v, Random & random)
+   {
+      fragments.add(pt, v, random);
+   }
+   void addStreek  (const Position & pt, const Velocity & v) { streeks.add(pt, v); }
+   void addExhaust (const Position & pt, const Velocity & v) { exhaust.add(pt, v); }
+
+   // all of [rhs]'s particles, after ours of the same kind
+   void append(const Effects & rhs);
+
+   // move them all one frame, dropping the dead. [jobs] and [grain]
+   // are for the fragments, as in Fragments::fly()
+   void fly(JobSystem * jobs = NULL, size_t grain = 0);
+
+   // remove everything but keep the memory
+   void clear();
+
+   // getters
+   size_t size()  const { return fragments.size() + streeks.size() + exhaust.size();    }
+   size_t bytes() const { return fragments.bytes() + streeks.bytes() + exhaust.bytes(); }
+   const Fragments & getFragments() const { return fragments; }
+   const Trails & getStreeks()      const { return streeks;   }
+   const Trails & getExhaust()      const { return exhaust;   }
+
+private:
+   Fragments fragments;
+   Trails streeks;
+   Trails exhaust;
 };
@@ -5,17 +5,125 @@
  *    Br. Helfrich
  * Summary:
  *    The file that contains main()
+ *
+ *    skeet [-f fps] [-w file] [-p file] [-l levels] [-S kinds]
+ *
+ *    The simulation always steps FRAMES_PER_SECOND times a second. The
+ *    screen is drawn -f times a second (60 by default), and each frame
+ *    is drawn part way between the last two steps so motion is smooth
+ *    at any frame rate. This puts the picture one step behind.
+ *
+ *    With -w every step of input is recorded and written to the file
+ *    as a replay when the program ends. skeet-replay plays it back.
+ *
+ *    P shows how long each stage of a frame takes. With -p the time
+ *    of every stage of every frame is also written to the file as CSV.
+ *
+ *    With -l the game plays the levels in that file instead of the
+ *    standard ones.
+ *
+ *    With -S the game is a stress test (see stress.h) of the kinds
+ *    given: "all" or a list of birds, missiles, bombs, and fragments.
+ *    Every frame is exactly one step, however long it takes, and the
+ *    step and the drawing are timed apart. When it is done the curve
+ *    is written out and the program ends.
+ *
+ *    When the program ends it reports how steady the frame rate was.
  ************************************************************************/
 
+#include <cstdlib>
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <memory>
 #include "uiInteract.h"
 #include "skeet.h"
+#include "renderer.h"
 #include "position.h"
+#include "replay.h"
+#include "profiler.h"
+#include "stress.h"
+#include "uiDraw.h"
 
 #define WIDTH  800.0
 #define HEIGHT 800.0
 
-Position Bullet::dimensions(WIDTH, HEIGHT);
-Position Bird::dimensions(WIDTH, HEIGHT);
+/*********************************************
+ * GAME
+ * Everything the callback needs: the simulation and
+ * when it is due for its next step
+ *********************************************/
+struct Game
+{
+   Game(const Position & dimensions, uint64_t seed, const Levels * levels) :
+      skeet(dimensions, seed, levels), ticks(FRAMES_PER_SECOND), showProfile(false), stress(NULL)
+   {
+      skeet.setProfiler(&profiler);
+   }
+
+   Skeet skeet;
+   Pacer ticks;       // steps of the simulation, not frames on the screen
+   Profiler profiler; // how long each stage of a frame takes
+   bool showProfile;  // is the profiler on the screen?
+   Stress * stress;   // the stress test, if this is one
+};
+
+// the game being recorded, if any. GLUT never returns from its main
+// loop; it calls exit(), so the replay is written on the way out.
+static Replay * pReplay = NULL;
+static const char * replayFile = NULL;
+static void saveReplay()
+{
+   if (pReplay && !pReplay->save(replayFile))
+      std::cerr << "cannot write replay " << replayFile << std::endl;
+}
+
+// how well did we keep to the frame rate? Like the replay, this is
+// on the way out, and so has to find the window's pacer globally
+static const Pacer * pPacer = NULL;
+static void reportPacing()
+{
+   const Pacer & pacer = *pPacer;
+   std::cout << "frames: " << pacer.getFrameTime() << " ms apart (target "
+             << 1000.0 / pacer.getFramesPerSecond() << "), jitter "
+             << pacer.getJitter() << " ms, worst " << pacer.getWorstJitter() << " ms\n";
+}
+
+/*********************************************
+ * STRESS FRAME
+ * Top the game up, take one step, and draw it, timing
+ * the step and the drawing. The drawing is timed up to
+ * handing it to OpenGL, not to it being on the screen
+ *********************************************/
+static void stressFrame(UserInput * pUI, Game & game)
+{
+   typedef std::chrono::steady_clock Clock;
+   Stress & stress = *game.stress;
+   Skeet & skeet = game.skeet;
+
+   stress.fill(skeet);
+   Clock::time_point begin = Clock::now();
+   skeet.interact(pUI->takeInput());
+   skeet.animate();
+   Clock::time_point middle = Clock::now();
+
+   Renderer renderer(skeet, &game.profiler);
+   if (skeet.isPlaying())
+      renderer.drawLevel();
+   else
+      renderer.drawStatus();
+   drawFlush();
+   Clock::time_point end = Clock::now();
+
+   stress.record(skeet, std::chrono::duration<double, std::milli>(middle - begin).count(),
+                        std::chrono::duration<double, std::milli>(end - middle).count());
+   if (stress.isDone())
+   {
+      stress.report(std::cout);
+      exit(0);
+   }
+}
 
  /*************************************
   * All the interesting work happens here, when
@@ -24,23 +132,61 @@ Position Bird::dimensions(WIDTH, HEIGHT);
   * engine will wait until the proper amount of
   * time has passed and put the drawing on the screen.
   **************************************/
-void callBack(const UserInput* pUI, void* p)
+void callBack(UserInput* pUI, void* p)
 {
    // the first step is to cast the void pointer into a game object. This
    // is the first step of every single callback function in OpenGL. 
-   Skeet* pSkeet = (Skeet*)p;
+   Game* pGame = (Game*)p;
+   Skeet & skeet = pGame->skeet;
+   Profiler & profiler = pGame->profiler;
+
+   // a stress test is one step a frame, timed apart from the drawing
+   if (pGame->stress)
+   {
+      stressFrame(pUI, *pGame);
+      return;
+   }
 
-   // handle user input
-   pSkeet->interact(*pUI);
+   // step the simulation as many times as the wall clock says is due
+   for (int steps = pGame->ticks.stepsDue(); steps > 0; steps--)
+   {
+      // show or hide the profiler. Nothing is timed when no one is looking
+      if (pUI->isP())
+      {
+         pGame->showProfile = !pGame->showProfile;
+         profiler.setEnabled(pGame->showProfile || profiler.isLogging());
+      }
 
-   // move the stuff
-   pSkeet->animate();
+      // handle the keys pressed up to when this step was due, keeping
+      // a copy if we are recording
+      {
+         ProfileScope scope(&profiler, STAGE_INTERACT);
+         Input input = pUI->takeInput(pGame->ticks.getStepTime(steps - 1));
+         if (pReplay)
+            pReplay->record(input);
+         skeet.interact(input);
+      }
 
-   // output the stuff
-   if (pSkeet->isPlaying())
-      pSkeet->drawLevel();
+      // move the stuff
+      skeet.animate();
+   }
+
+   // output the stuff, between the last step and the next
+   Renderer renderer(skeet, &profiler);
+   if (skeet.isPlaying())
+      renderer.drawLevel(pGame->ticks.getAlpha());
    else
-      pSkeet->drawStatus();
+      renderer.drawStatus();
+   if (pGame->showProfile)
+      renderer.drawProfile();
+
+   // hand the frame to OpenGL now so it is timed with the rest
+   {
+      ProfileScope scope(&profiler, STAGE_DRAW_FLUSH);
+      drawFlush();
+   }
+   if (profiler.isEnabled())
+      profiler.endFrame();
 }
 
 /*********************************
@@ -65,11 +211,64 @@ int main(int argc, char** argv)
       "Skeet",
       dimensions);
 
-   // initialize the game class
-   Skeet skeet(dimensions);
+   // the levels come first: the game cannot change them once it starts.
+   // A stress test has a level of its own
+   Levels levels;
+   std::unique_ptr<Stress> stress;
+#ifndef _WIN32_X
+   for (int i = 1; i + 1 < argc; i += 2)
+      if (strcmp(argv[i], "-l") == 0 && !levels.load(argv[i + 1]))
+      {
+         std::cerr << levels.getError() << std::endl;
+         return 1;
+      }
+      else if (strcmp(argv[i], "-S") == 0)
+      {
+         int kinds = Stress::parseKinds(argv[i + 1]);
+         if (kinds == 0)
+         {
+            std::cerr << "-S takes all, or a list of birds, missiles, bombs, and fragments\n";
+            return 1;
+         }
+         stress.reset(new Stress(kinds));
+      }
+#endif // !_WIN32_X
+
+   // initialize the game class. Every run is a new game.
+   uint64_t seed = (uint64_t)time(NULL);
+   Game game(dimensions, seed, stress ? &Stress::getLevels() : &levels);
+   game.stress = stress.get();
+
+   pPacer = &ui.getPacer();
+   atexit(reportPacing);
+
+   // how often to draw, and should we record the game?
+   Replay replay(seed, dimensions);
+   ui.setFramesPerSecond(60.0);
+#ifndef _WIN32_X
+   for (int i = 1; i + 1 < argc; i += 2)
+   {
+      if (strcmp(argv[i], "-f") == 0 && atof(argv[i + 1]) > 0.0)
+         ui.setFramesPerSecond(atof(argv[i + 1]));
+      else if (strcmp(argv[i], "-w") == 0)
+      {
+         replayFile = argv[i + 1];
+         pReplay = &replay;
+      }
+      else if (strcmp(argv[i], "-p") == 0)
+      {
+         if (game.profiler.openCsv(argv[i + 1]))
+            game.profiler.setEnabled(true);
+         else
+            std::cerr << "cannot write profile " << argv[i + 1] << std::endl;
+      }
+   }
+   if (pReplay)
+      atexit(saveReplay);
+#endif // !_WIN32_X
 
    // set everything into action
-   ui.run(callBack, &skeet);
+   ui.run(callBack, &game);
 
    return 0;
 }
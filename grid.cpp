@@ -0,0 +1,111 @@
+/***********************************************************************
+ * Source File:
+ *    GRID : Find the bullets that might hit a bird
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    A uniform grid over the screen. Each bullet goes into every cell
+ *    touched by the box it sweeps this frame; a bird then only needs to
+ *    be checked against the bullets in the cells its own box touches.
+ ************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+#include "grid.h"
+
+/*********************************************
+ * BOX : CONSTRUCTOR
+ * The path from pt to pt + v, grown by the radius
+ *********************************************/
+Grid::Box::Box(const Position & pt, const Velocity & v, double radius)
+{
+   double xEnd = pt.getX() + v.getDx();
+   double yEnd = pt.getY() + v.getDy();
+   xMin = std::min(pt.getX(), xEnd) - radius;
+   xMax = std::max(pt.getX(), xEnd) + radius;
+   yMin = std::min(pt.getY(), yEnd) - radius;
+   yMax = std::max(pt.getY(), yEnd) + radius;
+}
+
+/*********************************************
+ * GRID : CONSTRUCTOR
+ * Cover the screen with cells. Anything off the screen
+ * lands in the cells along the edge.
+ *********************************************/
+Grid::Grid(const Position & dimensions, double cellSize) : cellSize(cellSize)
+{
+   assert(cellSize > 0.0);
+   numColumns = std::max(1, (int)(dimensions.getX() / cellSize) + 1);
+   numRows    = std::max(1, (int)(dimensions.getY() / cellSize) + 1);
+   cells.resize(numColumns * numRows);
+}
+
+/*********************************************
+ * GRID : COLUMN and ROW
+ *********************************************/
+int Grid::column(double x) const
+{
+   if (!(x >= 0.0))   // also catches NaN
+      return 0;
+   return std::min(numColumns - 1, (int)(x / cellSize));
+}
+int Grid::row(double y) const
+{
+   if (!(y >= 0.0))
+      return 0;
+   return std::min(numRows - 1, (int)(y / cellSize));
+}
+
+/*********************************************
+ * GRID : CLEAR
+ * Only the cells we used need to be emptied
+ *********************************************/
+void Grid::clear()
+{
+   for (int cell : used)
+      cells[cell].clear();
+   used.clear();
+   boxes.clear();
+}
+
+/*********************************************
+ * GRID : INSERT
+ *********************************************/
+void Grid::insert(int id, const Position & pt, const Velocity & v, double radius)
+{
+   assert(id >= 0);
+   Box box(pt, v, radius);
+   if ((int)boxes.size() <= id)
+      boxes.resize(id + 1, box);
+   boxes[id] = box;
+
+   for (int r = row(box.yMin); r <= row(box.yMax); r++)
+      for (int c = column(box.xMin); c <= column(box.xMax); c++)
+      {
+         std::vector<int> & cell = cells[r * numColumns + c];
+         if (cell.empty())
+            used.push_back(r * numColumns + c);
+         cell.push_back(id);
+      }
+}
+
+/*********************************************
+ * GRID : QUERY
+ * Gather every id in the cells we touch whose box
+ * really does overlap ours
+ *********************************************/
+void Grid::query(const Position & pt, const Velocity & v, double radius,
+                 std::vector<int> & ids) const
+{
+   ids.clear();
+   Box box(pt, v, radius);
+   for (int r = row(box.yMin); r <= row(box.yMax); r++)
+      for (int c = column(box.xMin); c <= column(box.xMax); c++)
+         for (int id : cells[r * numColumns + c])
+            if (boxes[id].overlaps(box))
+               ids.push_back(id);
+
+   // something in two cells shows up twice
+   std::sort(ids.begin(), ids.end());
+   ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+}
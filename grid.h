@@ -0,0 +1,66 @@
+/***********************************************************************
+ * Header File:
+ *    GRID : Find the bullets that might hit a bird
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    A uniform grid over the screen. Each bullet goes into every cell
+ *    touched by the box it sweeps this frame; a bird then only needs to
+ *    be checked against the bullets in the cells its own box touches.
+ *    The box is the whole path from pt to pt + v grown by the radius,
+ *    which covers every point minimumDistance() looks at, so the grid
+ *    never throws away a pair that could be a hit.
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include "position.h"
+
+/*********************************************
+ * GRID
+ * Uniform grid broadphase for hit detection
+ *********************************************/
+class Grid
+{
+public:
+   Grid(const Position & dimensions, double cellSize = 50.0);
+
+   // empty the grid for a new frame. Keeps its memory.
+   void clear();
+
+   // put an element in every cell its swept box touches
+   void insert(int id, const Position & pt, const Velocity & v, double radius);
+
+   // everything whose swept box overlaps this one, in increasing id
+   // order with no duplicates
+   void query(const Position & pt, const Velocity & v, double radius,
+              std::vector<int> & ids) const;
+
+private:
+   /**********************
+    * BOX
+    * The area swept by something moving for one frame
+    **********************/
+   struct Box
+   {
+      Box(const Position & pt, const Velocity & v, double radius);
+      bool overlaps(const Box & rhs) const
+      {
+         return xMin <= rhs.xMax && rhs.xMin <= xMax &&
+                yMin <= rhs.yMax && rhs.yMin <= yMax;
+      }
+      double xMin, xMax, yMin, yMax;
+   };
+
+   // which column or row is this coordinate in? Clamped to the grid.
+   int column(double x) const;
+   int row(double y)    const;
+
+   double cellSize;
+   int numColumns;
+   int numRows;
+   std::vector<std::vector<int>> cells;  // ids in each cell
+   std::vector<Box> boxes;               // the box of each id
+   std::vector<int> used;                // cells with something in them
+};
@@ -10,7 +10,6 @@
 #pragma once
 #include "position.h"
 #include "time.h"
-#include "uiInteract.h"
 #include "bullet.h"
 #include <list>
 
@@ -23,9 +22,9 @@ class Gun
 {
 public:
    Gun(const Position & pt) : angle(0.78 /* 45 degrees */), pt(pt) {}  // 45 degrees initially
-   void display() const;
    void interact(int clockwise, int counterclockwise);
    double getAngle() const { return angle; }
+   Position getPosition() const { return pt; }
 
 private:
    double angle;
@@ -0,0 +1,59 @@
+/***********************************************************************
+ * Header File:
+ *    INPUT : The controls for one frame of the game
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    A snapshot of the keys the player is pressing. The simulation only
+ *    ever sees this snapshot so it does not need OpenGL or GLUT to run:
+ *    the window fills one in from the keyboard, a headless driver fills
+ *    one in from a script.
+ *
+ *    Space, M, and B count how many times they were pressed during the
+ *    step, and every press is a shot.
+ ************************************************************************/
+
+#pragma once
+
+/********************************************
+ * INPUT
+ * What the player is doing this frame
+ ********************************************/
+class Input
+{
+public:
+   Input() : downPress(0), upPress(0), leftPress(0), rightPress(0),
+             spacePress(0), mPress(0), bPress(0),
+             shiftPress(false) {}
+
+   // getters: the arrows count how many frames they have been held,
+   // the others how many times they were pressed this frame
+   int  isDown()      const { return downPress;  }
+   int  isUp()        const { return upPress;    }
+   int  isLeft()      const { return leftPress;  }
+   int  isRight()     const { return rightPress; }
+   int  isSpace()     const { return spacePress; }
+   int  isM()         const { return mPress;     }
+   int  isB()         const { return bPress;     }
+   bool isShift()     const { return shiftPress; }
+
+   // setters
+   void setDown(int frames)   { downPress  = frames; }
+   void setUp(int frames)     { upPress    = frames; }
+   void setLeft(int frames)   { leftPress  = frames; }
+   void setRight(int frames)  { rightPress = frames; }
+   void setSpace(int presses) { spacePress = presses; }
+   void setM(int presses)     { mPress     = presses; }
+   void setB(int presses)     { bPress     = presses; }
+   void setShift(bool press)  { shiftPress = press;  }
+
+private:
+   int  downPress;          // frames the down arrow has been held
+   int  upPress;            //    "   up         "
+   int  leftPress;          //    "   left       "
+   int  rightPress;         //    "   right      "
+   int  spacePress;         // times space was pressed this frame
+   int  mPress;             //    "  M           "
+   int  bPress;             //    "  B           "
+   bool shiftPress;         // is the shift key down?
+};
@@ -0,0 +1,72 @@
+/***********************************************************************
+ * Source File:
+ *    INPUT QUEUE : Every key, at the moment it was pressed
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    Turning key events into the input of each step
+ ************************************************************************/
+
+#include "inputQueue.h"
+
+/*********************************************
+ * INPUT QUEUE constructor
+ *********************************************/
+InputQueue::InputQueue() : shift(false)
+{
+   for (int & steps : held)
+      steps = 0;
+}
+
+/*********************************************
+ * INPUT QUEUE : PUSH
+ *********************************************/
+bool InputQueue::push(Key key, bool down, bool shift, Clock::time_point time)
+{
+   return events.push(Event { time, key, down, shift });
+}
+
+/*********************************************
+ * INPUT QUEUE : TAKE
+ * Count the presses and follow the arrows through every
+ * event up to [time], then age the arrows still held
+ *********************************************/
+Input InputQueue::take(Clock::time_point time)
+{
+   int presses[3] = { 0, 0, 0 };
+   bool tapped[4] = { false, false, false, false };
+
+   for (const Event * event; (event = events.front()) != NULL && event->time <= time; events.pop())
+   {
+      shift = event->shift;
+      if (event->key < DOWN)
+         presses[event->key] += event->down;
+      else if (event->down)
+      {
+         // a key that is already down stays as long as it has been
+         if (held[event->key - DOWN] == 0)
+            held[event->key - DOWN] = 1;
+         tapped[event->key - DOWN] = true;
+      }
+      else
+         held[event->key - DOWN] = 0;
+   }
+
+   Input input;
+   input.setSpace(presses[SPACE]);
+   input.setM(presses[M]);
+   input.setB(presses[B]);
+   input.setShift(shift);
+   int arrows[4];
+   for (int i = 0; i < 4; i++)
+   {
+      arrows[i] = held[i] ? held[i] : tapped[i];
+      if (held[i])
+         held[i]++;
+   }
+   input.setDown(arrows[DOWN - DOWN]);
+   input.setUp(arrows[UP - DOWN]);
+   input.setLeft(arrows[LEFT - DOWN]);
+   input.setRight(arrows[RIGHT - DOWN]);
+   return input;
+}
@@ -0,0 +1,63 @@
+/***********************************************************************
+ * Header File:
+ *    INPUT QUEUE : Every key, at the moment it was pressed
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The window pushes every key going down or up, with the time it
+ *    happened, into a lock-free ring. Each step of the game then takes
+ *    the events up to the time that step was due and nothing after,
+ *    so a key lands in the step it was pressed in however late the
+ *    frame that gets around to it.
+ *
+ *    Every press counts: two presses of space in one step are two
+ *    shots, not one. An arrow tapped and let go within a step is still
+ *    held for that step. Held arrows count the steps they have been held.
+ *
+ *    The window is the only producer and the game loop the only
+ *    consumer, so they can be on different threads.
+ ************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include "input.h"
+#include "ring.h"
+
+#define INPUT_EVENTS 256    // key events that can wait for a step
+
+/*********************************************
+ * INPUT QUEUE
+ * Key events on their way to the game
+ *********************************************/
+class InputQueue
+{
+public:
+   typedef std::chrono::steady_clock Clock;
+
+   // the keys the game cares about
+   enum Key { SPACE, M, B, DOWN, UP, LEFT, RIGHT };
+
+   InputQueue();
+
+   // the window: [key] went down or up, with shift down or not. False if
+   // the game has fallen so far behind that the queue is full
+   bool push(Key key, bool down, bool shift, Clock::time_point time = Clock::now());
+
+   // the game: everything that happened up to [time] as the input of one
+   // step. Call once a step, in order
+   Input take(Clock::time_point time = Clock::now());
+
+private:
+   struct Event
+   {
+      Clock::time_point time;
+      Key key;
+      bool down;
+      bool shift;
+   };
+
+   Ring<Event, INPUT_EVENTS> events;
+   int held[4];         // steps each arrow has been held, 0 if it is up
+   bool shift;          // was shift down at the last event?
+};
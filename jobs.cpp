@@ -0,0 +1,151 @@
+/***********************************************************************
+ * Source File:
+ *    JOBS : Spread a loop across every core
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The work-stealing scheduler behind parallelFor()
+ ************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+#include "jobs.h"
+
+using namespace std;
+
+/*********************************************
+ * JOB SYSTEM constructor
+ * The caller is thread 0 and does its share of the
+ * work, so start one fewer thread than asked for
+ *********************************************/
+JobSystem::JobSystem(int numThreads) :
+   body(NULL), queued(0), remaining(0), stopping(false)
+{
+   if (numThreads <= 0)
+      numThreads = max(1, (int)thread::hardware_concurrency());
+   for (int i = 0; i < numThreads; i++)
+      queues.push_back(unique_ptr<Queue>(new Queue));
+   for (int i = 1; i < numThreads; i++)
+      threads.emplace_back(&JobSystem::work, this, i);
+}
+
+/*********************************************
+ * JOB SYSTEM destructor
+ *********************************************/
+JobSystem::~JobSystem()
+{
+   {
+      lock_guard<mutex> guard(sleepLock);
+      stopping = true;
+   }
+   wake.notify_all();
+   for (thread & worker : threads)
+      worker.join();
+}
+
+/*********************************************
+ * JOB SYSTEM : PARALLEL FOR
+ * Each thread is dealt a run of neighboring chunks so
+ * that, until someone steals, it works on memory
+ * next to what it just worked on
+ *********************************************/
+void JobSystem::parallelFor(size_t count, size_t grain, const Body & body)
+{
+   assert(grain > 0);
+   assert(this->body == NULL);   // not from inside a chunk
+   size_t numChunks = (count + grain - 1) / grain;
+
+   // nothing to share: do it right here
+   if (numChunks <= 1 || queues.size() == 1)
+   {
+      for (size_t chunk = 0; chunk < numChunks; chunk++)
+         body(chunk, chunk * grain, min(count, (chunk + 1) * grain));
+      return;
+   }
+
+   // deal out the chunks
+   this->body = &body;
+   remaining = numChunks;
+   queued += numChunks;
+   for (size_t chunk = 0; chunk < numChunks; chunk++)
+   {
+      Queue & queue = *queues[chunk * queues.size() / numChunks];
+      lock_guard<mutex> guard(queue.lock);
+      queue.jobs.push_back(Job { chunk, chunk * grain, min(count, (chunk + 1) * grain) });
+   }
+   {
+      lock_guard<mutex> guard(sleepLock);
+   }
+   wake.notify_all();
+
+   // do our share, then wait for the stragglers
+   Job job;
+   while (remaining > 0)
+      if (pop(0, job))
+         run(job);
+      else
+         this_thread::yield();
+   this->body = NULL;
+}
+
+/*********************************************
+ * JOB SYSTEM : POP
+ * Take the newest job from our own queue, or failing
+ * that the oldest from someone else's
+ *********************************************/
+bool JobSystem::pop(int thread, Job & job)
+{
+   size_t numQueues = queues.size();
+   for (size_t i = 0; i < numQueues; i++)
+   {
+      Queue & queue = *queues[(thread + i) % numQueues];
+      lock_guard<mutex> guard(queue.lock);
+      if (queue.jobs.empty())
+         continue;
+      if (i == 0)
+      {
+         job = queue.jobs.back();
+         queue.jobs.pop_back();
+      }
+      else
+      {
+         job = queue.jobs.front();
+         queue.jobs.pop_front();
+      }
+      queued--;
+      return true;
+   }
+   return false;
+}
+
+/*********************************************
+ * JOB SYSTEM : RUN
+ *********************************************/
+void JobSystem::run(const Job & job)
+{
+   (*body)(job.chunk, job.begin, job.end);
+   remaining--;
+}
+
+/*********************************************
+ * JOB SYSTEM : WORK
+ * A worker thread: take jobs while there are any,
+ * sleep when there are none
+ *********************************************/
+void JobSystem::work(int thread)
+{
+   while (true)
+   {
+      Job job;
+      if (pop(thread, job))
+      {
+         run(job);
+         continue;
+      }
+
+      unique_lock<mutex> guard(sleepLock);
+      wake.wait(guard, [this] { return stopping || queued > 0; });
+      if (stopping)
+         return;
+   }
+}
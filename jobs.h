@@ -0,0 +1,80 @@
+/***********************************************************************
+ * Header File:
+ *    JOBS : Spread a loop across every core
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    A small work-stealing scheduler. parallelFor() cuts a range into
+ *    chunks, deals them out to a queue per thread, and every thread
+ *    (the caller included) works through its own queue from the back
+ *    and steals from the front of the others when it runs dry. It
+ *    returns when every chunk is done.
+ *
+ *    The chunks are always the same for the same range and grain no
+ *    matter how many threads there are, and each knows its number. So
+ *    anything a chunk produces can be kept per chunk and put together
+ *    in chunk order afterwards, and the answer is the same as one
+ *    thread would get.
+ *
+ *    One parallelFor() at a time, and not from inside a chunk.
+ ************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*********************************************
+ * JOB SYSTEM
+ * Worker threads that share out chunks of a loop
+ *********************************************/
+class JobSystem
+{
+public:
+   // what a chunk does: [chunk] is its number, [begin, end) its range
+   typedef std::function<void(size_t chunk, size_t begin, size_t end)> Body;
+
+   // [numThreads] counts the caller. 0 is one for every core
+   JobSystem(int numThreads = 0);
+   ~JobSystem();
+   JobSystem(const JobSystem &) = delete;
+   JobSystem & operator = (const JobSystem &) = delete;
+
+   int getThreads() const { return (int)queues.size(); }
+
+   // run [body] on every chunk of [grain] in [0, count) and wait
+   void parallelFor(size_t count, size_t grain, const Body & body);
+
+private:
+   struct Job
+   {
+      size_t chunk;
+      size_t begin;
+      size_t end;
+   };
+   struct Queue
+   {
+      std::mutex lock;
+      std::deque<Job> jobs;
+   };
+
+   bool pop(int thread, Job & job);   // our own, or someone else's
+   void run(const Job & job);
+   void work(int thread);             // what the worker threads do
+
+   std::vector<std::unique_ptr<Queue>> queues;  // one per thread, the caller's first
+   std::vector<std::thread> threads;
+   const Body * body;                 // the loop being run
+   std::atomic<size_t> queued;        // chunks not yet taken
+   std::atomic<size_t> remaining;     // chunks not yet finished
+   std::mutex sleepLock;              // workers sleep until there are jobs
+   std::condition_variable wake;
+   bool stopping;
+};
@@ -0,0 +1,212 @@
+/***********************************************************************
+ * Source File:
+ *    LEVEL : What birds come out in each level, and how often
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    Reading the levels, and the standard four
+ ************************************************************************/
+
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include "level.h"
+#include "time.h"
+
+#define LEVEL_MOST_SECONDS (INT_MAX / FRAMES_PER_SECOND) // frames have to fit in an int
+#define LEVEL_SMALLEST_BIRD 5.0  // the rings drawn inside a bird need more than this
+#define LEVEL_MOST_AT_ONCE 1000  // birds from one chance
+using namespace std;
+
+// the levels the game has always had. The birds take their chances in
+// this order, so games from the same seed play the same as they always have
+static const char * STANDARD_LEVELS = R"(
+# level 1: big birds occasionally
+level 30
+standard 30  7.0  10   15  empty
+standard 30  7.0  10  120
+
+# level 2: two kinds of birds
+level 30
+standard 25  7.0  12   15  empty
+standard 25  5.0  12  120
+sinker   25  4.5  20   90
+
+# level 3: three kinds of birds
+level 45
+standard 20  5.0  15   15  empty
+standard 20  5.0  15  120
+sinker   20  4.0  22  120
+floater  20  5.0  15  120
+
+# level 4: four kinds of birds
+level 45
+standard 15  4.0  18   15  empty
+standard 15  4.0  18  120
+sinker   15  3.5  25  120
+floater  15  4.0  25  120
+crazy    15  4.5  30  120
+)";
+
+/*********************************************
+ * LEVELS constructor
+ *********************************************/
+Levels::Levels()
+{
+   istringstream in(STANDARD_LEVELS);
+   bool ok = read(in);
+   assert(ok);
+   (void)ok;
+}
+
+/*********************************************
+ * LEVELS : STANDARD
+ *********************************************/
+const Levels & Levels::standard()
+{
+   static const Levels levels;
+   return levels;
+}
+
+/*********************************************
+ * LEVELS : LOAD
+ *********************************************/
+bool Levels::load(const string & fileName)
+{
+   ifstream in(fileName);
+   if (!in)
+   {
+      error = "cannot read " + fileName;
+      return false;
+   }
+   if (read(in))
+      return true;
+   error = fileName + ": " + error;
+   return false;
+}
+
+/*********************************************
+ * PARSE NUMBER
+ * The whole word has to be the number
+ *********************************************/
+static bool parse(const string & word, double & value)
+{
+   char * end;
+   value = strtod(word.c_str(), &end);
+   return !word.empty() && *end == '\0';
+}
+static bool parse(const string & word, int & value)
+{
+   char * end;
+   errno = 0;
+   long number = strtol(word.c_str(), &end, 10);
+   if (word.empty() || *end != '\0' || errno == ERANGE ||
+       number < INT_MIN || number > INT_MAX)
+      return false;
+   value = (int)number;
+   return true;
+}
+
+/*********************************************
+ * LEVELS : READ
+ * One line at a time, into a new set of levels that
+ * only replaces the old one if every line made sense
+ *********************************************/
+bool Levels::read(istream & in)
+{
+   vector<Level> levels;
+   string line;
+   for (int number = 1; getline(in, line); number++)
+   {
+      // what went wrong, and where
+      auto fail = [&](const string & what)
+      {
+         error = "line " + to_string(number) + ": " + what;
+         return false;
+      };
+
+      // everything after a # is a comment
+      istringstream words(line.substr(0, line.find('#')));
+      string word;
+      if (!(words >> word))
+         continue;
+
+      // the start of a new level
+      if (word == "level")
+      {
+         Level level;
+         if (!(words >> word) || !parse(word, level.seconds))
+            return fail("expected: level <seconds>");
+         if (level.seconds <= SECONDS_STATUS)
+            return fail("a level has to be longer than the status screen");
+         if (level.seconds > LEVEL_MOST_SECONDS)
+            return fail("a level can be at most " + to_string(LEVEL_MOST_SECONDS) + " seconds");
+         if (words >> word)
+            return fail("unexpected \"" + word + "\"");
+         levels.push_back(level);
+         continue;
+      }
+
+      // a kind of bird
+      Spawner spawner;
+      if (word == "standard")
+         spawner.kind = Spawner::STANDARD;
+      else if (word == "floater")
+         spawner.kind = Spawner::FLOATER;
+      else if (word == "crazy")
+         spawner.kind = Spawner::CRAZY;
+      else if (word == "sinker")
+         spawner.kind = Spawner::SINKER;
+      else
+         return fail("unknown bird \"" + word + "\"");
+      if (levels.empty())
+         return fail("a bird has to come after a level");
+
+      string radius, speed, points, odds;
+      if (!(words >> radius >> speed >> points >> odds) ||
+          !parse(radius, spawner.radius) || !parse(speed, spawner.speed) ||
+          !parse(points, spawner.points) || !parse(odds, spawner.odds))
+         return fail("expected: " + word + " <radius> <speed> <points> <odds> [empty] [x<count>]");
+      if (spawner.radius <= LEVEL_SMALLEST_BIRD)
+         return fail("the radius has to be more than " + to_string((int)LEVEL_SMALLEST_BIRD));
+      if (spawner.speed < 0.0 || spawner.odds < 1)
+         return fail("the odds have to be positive, and the speed not negative");
+
+      // anything else about it
+      spawner.count = 1;
+      spawner.whenEmpty = false;
+      while (words >> word)
+      {
+         if (word == "empty")
+            spawner.whenEmpty = true;
+         else if (word[0] == 'x' && parse(word.substr(1), spawner.count) &&
+                  spawner.count >= 1 && spawner.count <= LEVEL_MOST_AT_ONCE)
+            continue;
+         else
+            return fail("unexpected \"" + word + "\"");
+      }
+      levels.back().spawners.push_back(spawner);
+   }
+
+   if (levels.empty())
+   {
+      error = "no levels";
+      return false;
+   }
+   this->levels = levels;
+   error.clear();
+   return true;
+}
+
+/*********************************************
+ * LEVELS : GET SECONDS
+ *********************************************/
+vector<int> Levels::getSeconds() const
+{
+   vector<int> seconds;
+   for (const Level & level : levels)
+      seconds.push_back(level.seconds);
+   return seconds;
+}
@@ -0,0 +1,95 @@
+/***********************************************************************
+ * Header File:
+ *    LEVEL : What birds come out in each level, and how often
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The levels are read from text once, when the program starts, into a
+ *    table spawn() walks every frame: one Spawner per line, so a frame
+ *    costs one check for every kind of bird in the level and nothing is
+ *    looked up by name. Without a file, the game plays the standard four
+ *    levels.
+ *
+ *    One line per level or bird, with # starting a comment:
+ *
+ *      level <seconds>
+ *      <bird> <radius> <speed> <points> <odds> [empty] [x<count>]
+ *
+ *    A level lasts <seconds>, the 5 second status screen included. Each
+ *    bird line after it is a chance, every frame of play, of <count>
+ *    birds (1 if not given, at most 1000) of that kind: standard,
+ *    floater, crazy, or sinker, with a radius of more than 5. The chance
+ *    is one in <odds>, and odds of 1 is every frame. With "empty" the
+ *    chance is only taken when there are no birds on the screen. The
+ *    lines are tried in order, and each takes its own random number, so
+ *    the same file and seed play the same game.
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <istream>
+#include <string>
+#include <vector>
+
+/*********************************************
+ * SPAWNER
+ * One line of a level: the chance of a kind of bird
+ *********************************************/
+struct Spawner
+{
+   enum Kind { STANDARD, FLOATER, CRAZY, SINKER };
+
+   Kind kind;
+   double radius;
+   double speed;
+   int points;
+   int odds;         // one chance in this many every frame
+   int count;        // how many birds come out at once
+   bool whenEmpty;   // only when there are no birds on the screen
+};
+
+/*********************************************
+ * LEVEL
+ * How long, and what flies
+ *********************************************/
+struct Level
+{
+   int seconds;                    // the status screen included
+   std::vector<Spawner> spawners;  // tried in order every frame of play
+};
+
+/*********************************************
+ * LEVELS
+ * Every level of the game, from the first
+ *********************************************/
+class Levels
+{
+public:
+   // the standard four levels
+   Levels();
+
+   // replace the levels with those in a file or stream. On failure the
+   // levels are left alone and getError() says what was wrong and where
+   bool load(const std::string & fileName);
+   bool read(std::istream & in);
+   const std::string & getError() const { return error; }
+
+   // the levels are numbered from 1
+   int size() const { return (int)levels.size(); }
+   const Level & operator [] (int level) const
+   {
+      assert(level >= 1 && level <= size());
+      return levels[level - 1];
+   }
+
+   // how long each level is, the first level first
+   std::vector<int> getSeconds() const;
+
+   // the standard levels, shared by every game that does not have its own
+   static const Levels & standard();
+
+private:
+   std::vector<Level> levels;
+   std::string error;
+};
@@ -0,0 +1,475 @@
+/***********************************************************************
+ * Source File:
+ *    MICROBENCH : Time the hot paths of the simulation one at a time
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The file that contains main() for skeet-microbench, built on Google
+ *    Benchmark. Every benchmark is handed the same seeded random numbers
+ *    so two builds are timed on exactly the same work:
+ *
+ *      minimumDistance, turn       the geometry
+ *      advance<kind>               each kind of bird
+ *      move/kind                   each kind of bullet
+ *      fly/count, update           fragments, trails, and points
+ *      bombDeath                   a burst of shrapnel
+ *      flock/how, volley/how       mixed birds and bullets, called
+ *                                  three ways (see DISPATCH)
+ *      frame/bot/level             whole frames of animate()
+ *
+ *    frame plays full frames with a bot, one benchmark for every level
+ *    and bot, so the birds and bullets on the screen range from a few to
+ *    a crowd; the objects counter is how many were live on average.
+ *
+ *    The command line is Google Benchmark's own. To compare two commits,
+ *    repeat the runs so the noise can be measured and save them as JSON:
+ *
+ *      skeet-microbench --benchmark_repetitions=10
+ *                       --benchmark_report_aggregates_only=true
+ *                       --benchmark_out=before.json --benchmark_out_format=json
+ *
+ *    A change is real when the medians move by more than a few times the
+ *    cv (the standard deviation over the mean) that comes with them.
+ *    Google Benchmark's tools/compare.py does this test for two files.
+ ************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include "skeet.h"
+#include "bot.h"
+using namespace std;
+
+#define WIDTH  800.0
+#define HEIGHT 800.0
+#define SEED   331
+
+#define NUM_ELEMENTS 256   // birds, bullets, or points moved per iteration
+#define NUM_FRAMES   30    // frames before the elements are put back
+
+/*********************************************
+ * GEOMETRY
+ * Random positions and velocities to feed the math
+ *********************************************/
+struct Geometry
+{
+   Geometry(size_t count)
+   {
+      Random random(SEED);
+      for (size_t i = 0; i < count; i++)
+      {
+         pts.push_back(Position(random.nextDouble(0.0, WIDTH), random.nextDouble(0.0, HEIGHT)));
+         vs.push_back(Velocity(random.nextDouble(-30.0, 30.0), random.nextDouble(-30.0, 30.0)));
+      }
+   }
+   vector<Position> pts;
+   vector<Velocity> vs;
+};
+
+/*********************************************
+ * MINIMUM DISTANCE
+ * One bullet against one bird
+ *********************************************/
+static void minimumDistance(benchmark::State & state)
+{
+   Geometry geometry(NUM_ELEMENTS + 1);
+   for (auto _ : state)
+      for (size_t i = 0; i < NUM_ELEMENTS; i++)
+         benchmark::DoNotOptimize(minimumDistance(geometry.pts[i], geometry.vs[i],
+                                                  geometry.pts[i + 1], geometry.vs[i + 1]));
+   state.SetItemsProcessed(state.iterations() * NUM_ELEMENTS);
+}
+BENCHMARK(minimumDistance);
+
+/*********************************************
+ * VELOCITY TURN
+ * How a missile steers
+ *********************************************/
+static void turn(benchmark::State & state)
+{
+   Geometry geometry(NUM_ELEMENTS);
+   for (auto _ : state)
+   {
+      for (Velocity & v : geometry.vs)
+         v.turn(0.04);
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * NUM_ELEMENTS);
+}
+BENCHMARK(turn);
+
+/*********************************************
+ * ADVANCE
+ * A flock of one kind of bird, all flying. Every
+ * NUM_FRAMES frames the flock is put back where it
+ * started so it never all flies off the screen.
+ *********************************************/
+template <class Kind>
+static void advance(benchmark::State & state)
+{
+   Position dimensions(WIDTH, HEIGHT);
+   Random random(SEED);
+   BirdPool fresh(NUM_ELEMENTS);
+   for (int i = 0; i < NUM_ELEMENTS; i++)
+      fresh.add<Kind>(dimensions, random);
+   BirdPool birds = fresh;
+
+   int frame = 0;
+   for (auto _ : state)
+   {
+      for (auto & element : birds)
+         element.advance(dimensions, random);
+      if (++frame == NUM_FRAMES)
+      {
+         state.PauseTiming();
+         birds = fresh;
+         frame = 0;
+         state.ResumeTiming();
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * NUM_ELEMENTS);
+}
+BENCHMARK_TEMPLATE(advance, Standard);
+BENCHMARK_TEMPLATE(advance, Floater);
+BENCHMARK_TEMPLATE(advance, Crazy);
+BENCHMARK_TEMPLATE(advance, Sinker);
+
+/*********************************************
+ * MOVE
+ * A volley of one kind of bullet, fired across the
+ * screen, along with the trails they leave
+ *********************************************/
+static void move(benchmark::State & state,
+                 const function<void(BulletPool &, const Position &, Random &, double angle)> & fire)
+{
+   Position dimensions(WIDTH, HEIGHT);
+   Random random(SEED);
+   BulletPool fresh(NUM_ELEMENTS);
+   for (int i = 0; i < NUM_ELEMENTS; i++)
+      fire(fresh, dimensions, random, random.nextDouble(0.0, M_PI / 2.0));
+   BulletPool bullets = fresh;
+   Effects effects(4096);
+
+   int frame = 0;
+   for (auto _ : state)
+   {
+      for (auto & bullet : bullets)
+         bullet.move(dimensions, effects);
+      if (++frame == NUM_FRAMES)
+      {
+         state.PauseTiming();
+         bullets = fresh;
+         effects.clear();
+         frame = 0;
+         state.ResumeTiming();
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * NUM_ELEMENTS);
+}
+BENCHMARK_CAPTURE(move, Pellet, [](BulletPool & bullets, const Position & dimensions, Random &, double angle)
+{
+   bullets.add<Pellet>(dimensions, angle);
+});
+BENCHMARK_CAPTURE(move, Bomb, [](BulletPool & bullets, const Position & dimensions, Random &, double angle)
+{
+   bullets.add<Bomb>(dimensions, angle);
+});
+BENCHMARK_CAPTURE(move, Shrapnel, [](BulletPool & bullets, const Position & dimensions, Random & random, double angle)
+{
+   bullets.add<Shrapnel>(Bomb(dimensions, angle), random);
+});
+BENCHMARK_CAPTURE(move, Missile, [](BulletPool & bullets, const Position & dimensions, Random &, double angle)
+{
+   bullets.add<Missile>(dimensions, angle);
+});
+
+/*********************************************
+ * FLY
+ * The fragments of dead birds and the trails of
+ * bullets, [range(0)] fragments to start with
+ *********************************************/
+static void fly(benchmark::State & state)
+{
+   int numFragments = (int)state.range(0);
+   Geometry geometry(numFragments);
+   Random random(SEED);
+   Effects fresh(numFragments);
+   for (int i = 0; i < numFragments; i++)
+   {
+      fresh.addFragment(geometry.pts[i], geometry.vs[i], random);
+      if (i % 8 == 0)
+      {
+         fresh.addStreek(geometry.pts[i], geometry.vs[i]);
+         fresh.addExhaust(geometry.pts[i], geometry.vs[i]);
+      }
+   }
+   Effects effects = fresh;
+
+   int frame = 0;
+   for (auto _ : state)
+   {
+      effects.fly();
+      if (++frame == NUM_FRAMES)
+      {
+         state.PauseTiming();
+         effects = fresh;
+         frame = 0;
+         state.ResumeTiming();
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * numFragments);
+}
+BENCHMARK(fly)->Arg(256)->Arg(4096);
+
+/*********************************************
+ * UPDATE
+ * The points floating up from dead birds
+ *********************************************/
+static void update(benchmark::State & state)
+{
+   Geometry geometry(NUM_ELEMENTS);
+   Random random(SEED);
+   Position dimensions(WIDTH, HEIGHT);
+   Pool<Points> fresh(NUM_ELEMENTS);
+   for (int i = 0; i < NUM_ELEMENTS; i++)
+      fresh.add(dimensions, geometry.pts[i], random.nextInt(-10, 30), random);
+   Pool<Points> points = fresh;
+
+   int frame = 0;
+   for (auto _ : state)
+   {
+      for (auto & pts : points)
+         pts.update(random);
+      if (++frame == NUM_FRAMES)
+      {
+         state.PauseTiming();
+         points = fresh;
+         frame = 0;
+         state.ResumeTiming();
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * NUM_ELEMENTS);
+}
+BENCHMARK(update);
+
+/*********************************************
+ * BOMB DEATH
+ * One bomb going off into shrapnel
+ *********************************************/
+static void bombDeath(benchmark::State & state)
+{
+   Position dimensions(WIDTH, HEIGHT);
+   Random random(SEED);
+   Bomb bomb(dimensions, M_PI / 4.0);
+   BulletPool bullets(64);
+   size_t numShrapnel = 0;
+   for (auto _ : state)
+   {
+      bullets.clear();
+      bomb.death(bullets, random);
+      numShrapnel += bullets.size();
+   }
+   state.SetItemsProcessed(numShrapnel);
+}
+BENCHMARK(bombDeath);
+
+/*********************************************
+ * DISPATCH
+ * How to call every bird or bullet in a mixed pool:
+ *   virtual      through the base class, as the game used to
+ *   static       PolyPool::forEach, each as its own kind, in order
+ *   partitioned  one array per kind, kind after kind
+ * The game uses static. Partitioned is as fast as it can
+ * get, but it changes the order the elements are called
+ * in, and with it the game.
+ *********************************************/
+enum Dispatch { DISPATCH_VIRTUAL, DISPATCH_STATIC, DISPATCH_PARTITIONED };
+
+/*********************************************
+ * PARTITIONED
+ * The elements of a PolyPool, one array per kind
+ *********************************************/
+template <class ... Kinds>
+class Partitioned
+{
+public:
+   template <class Base>
+   Partitioned(const PolyPool<Base, Kinds...> & pool)
+   {
+      pool.forEach([this](const auto & element)
+      {
+         std::get<vector<std::decay_t<decltype(element)>>>(arrays).push_back(element);
+      });
+   }
+
+   template <class Function>
+   void forEach(Function f)
+   {
+      std::apply([&f](auto & ... array)
+      {
+         (..., [&f](auto & elements) { for (auto & element : elements) f(element); }(array));
+      }, arrays);
+   }
+
+private:
+   std::tuple<vector<Kinds>...> arrays;
+};
+
+/*********************************************
+ * FLOCK
+ * All four kinds of birds, mixed the way they spawn
+ *********************************************/
+static void flock(benchmark::State & state, Dispatch dispatch)
+{
+   Position dimensions(WIDTH, HEIGHT);
+   Random random(SEED);
+   BirdPool fresh(NUM_ELEMENTS);
+   for (int i = 0; i < NUM_ELEMENTS; i++)
+      switch (random.nextInt(0, 4))
+      {
+         case 0:  fresh.add<Standard>(dimensions, random); break;
+         case 1:  fresh.add<Floater>(dimensions, random);  break;
+         case 2:  fresh.add<Crazy>(dimensions, random);    break;
+         default: fresh.add<Sinker>(dimensions, random);   break;
+      }
+   BirdPool birds = fresh;
+   Partitioned<Standard, Floater, Crazy, Sinker> freshPartitioned(fresh);
+   Partitioned<Standard, Floater, Crazy, Sinker> partitioned = freshPartitioned;
+   auto advance = [&dimensions, &random](auto & element) { element.advance(dimensions, random); };
+
+   int frame = 0;
+   for (auto _ : state)
+   {
+      if (dispatch == DISPATCH_VIRTUAL)
+         for (Bird & element : birds)
+            element.advance(dimensions, random);
+      else if (dispatch == DISPATCH_STATIC)
+         birds.forEach(advance);
+      else
+         partitioned.forEach(advance);
+      if (++frame == NUM_FRAMES)
+      {
+         state.PauseTiming();
+         birds = fresh;
+         partitioned = freshPartitioned;
+         frame = 0;
+         state.ResumeTiming();
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * NUM_ELEMENTS);
+}
+BENCHMARK_CAPTURE(flock, virtual,     DISPATCH_VIRTUAL);
+BENCHMARK_CAPTURE(flock, static,      DISPATCH_STATIC);
+BENCHMARK_CAPTURE(flock, partitioned, DISPATCH_PARTITIONED);
+
+/*********************************************
+ * VOLLEY
+ * All four kinds of bullets, mixed
+ *********************************************/
+static void volley(benchmark::State & state, Dispatch dispatch)
+{
+   Position dimensions(WIDTH, HEIGHT);
+   Random random(SEED);
+   BulletPool fresh(NUM_ELEMENTS);
+   for (int i = 0; i < NUM_ELEMENTS; i++)
+   {
+      double angle = random.nextDouble(0.0, M_PI / 2.0);
+      switch (random.nextInt(0, 4))
+      {
+         case 0:  fresh.add<Pellet>(dimensions, angle);                  break;
+         case 1:  fresh.add<Bomb>(dimensions, angle);                    break;
+         case 2:  fresh.add<Shrapnel>(Bomb(dimensions, angle), random);  break;
+         default: fresh.add<Missile>(dimensions, angle);                 break;
+      }
+   }
+   BulletPool bullets = fresh;
+   Partitioned<Pellet, Bomb, Shrapnel, Missile> freshPartitioned(fresh);
+   Partitioned<Pellet, Bomb, Shrapnel, Missile> partitioned = freshPartitioned;
+   Effects effects(4096);
+   auto move = [&dimensions, &effects](auto & bullet) { bullet.move(dimensions, effects); };
+
+   int frame = 0;
+   for (auto _ : state)
+   {
+      if (dispatch == DISPATCH_VIRTUAL)
+         for (Bullet & bullet : bullets)
+            bullet.move(dimensions, effects);
+      else if (dispatch == DISPATCH_STATIC)
+         bullets.forEach(move);
+      else
+         partitioned.forEach(move);
+      if (++frame == NUM_FRAMES)
+      {
+         state.PauseTiming();
+         bullets = fresh;
+         partitioned = freshPartitioned;
+         effects.clear();
+         frame = 0;
+         state.ResumeTiming();
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * NUM_ELEMENTS);
+}
+BENCHMARK_CAPTURE(volley, virtual,     DISPATCH_VIRTUAL);
+BENCHMARK_CAPTURE(volley, static,      DISPATCH_STATIC);
+BENCHMARK_CAPTURE(volley, partitioned, DISPATCH_PARTITIONED);
+
+/*********************************************
+ * FRAME
+ * Whole frames: the bot's input and animate(). The
+ * game is played up to ten seconds into level
+ * [range(0)] and kept there; each time the level ends
+ * it is put back to that moment. The random bot sprays
+ * bullets; the aim bot shoots a few well-aimed ones.
+ *********************************************/
+static void frame(benchmark::State & state, bool aim)
+{
+   int level = (int)state.range(0);
+   Position dimensions(WIDTH, HEIGHT);
+   Skeet start(dimensions, SEED);
+   unique_ptr<Bot> bot;
+   if (aim)
+      bot.reset(new AimBot);
+   else
+      bot.reset(new RandomBot(SEED));
+
+   // play until ten seconds into the level so it has filled up
+   int played = 0;
+   while (!start.getTime().isGameOver() &&
+          (start.getTime().level() != level || !start.isPlaying() || played < 300))
+   {
+      start.interact(bot->play(start));
+      start.animate();
+      if (start.getTime().level() == level && start.isPlaying())
+         played++;
+   }
+   if (start.getTime().isGameOver())
+   {
+      state.SkipWithError("the game ended before the level");
+      return;
+   }
+
+   Skeet skeet = start;
+   size_t numObjects = 0;
+   for (auto _ : state)
+   {
+      skeet.interact(bot->play(skeet));
+      skeet.animate();
+      numObjects += skeet.getLiveObjects();
+      if (skeet.getTime().level() != level || !skeet.isPlaying())
+      {
+         state.PauseTiming();
+         skeet = start;
+         state.ResumeTiming();
+      }
+   }
+   state.counters["objects"] = benchmark::Counter((double)numObjects,
+                                                  benchmark::Counter::kAvgIterations);
+}
+BENCHMARK_CAPTURE(frame, aim,    true )->DenseRange(1, 4);
+BENCHMARK_CAPTURE(frame, random, false)->DenseRange(1, 4);
+
+BENCHMARK_MAIN();
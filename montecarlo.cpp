@@ -0,0 +1,340 @@
+/***********************************************************************
+ * Source File:
+ *    MONTE CARLO : Play a great many games to see how the levels play
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The file that contains main() for skeet-montecarlo. Every core
+ *    plays headless games, each in its own Skeet with its own seed, and
+ *    the results are added up level by level:
+ *
+ *      score       points won (or lost) during the level
+ *      hit ratio   birds shot out of the birds shot or missed, as the
+ *                  game shows it
+ *      escaped     birds that flew off the screen out of every bird
+ *                  that appeared, counting the ones still flying when
+ *                  the level ended
+ *      peak        the most birds, bullets, effects, and points that
+ *                  were live at once
+ *
+ *    skeet-montecarlo [-n games] [-s seed] [-b bot[,bot...]] [-j threads]
+ *                     [-l levels] [-o file]
+ *
+ *    Every bot plays the same games. Game n is seeded with seed + n, the
+ *    same as skeet-batch, so any one of them can be played again with
+ *    skeet-batch -n 1 -s <seed + n>. With -l the games play the levels in
+ *    that file instead of the standard ones. With -o the results are also
+ *    written as CSV, one line for each bot and level.
+ *
+ *    The games are dealt out in fixed batches and the batches are added
+ *    up in order, so the results are the same on any number of threads.
+ *    Each game has its own screen and nothing is shared between them but
+ *    the levels, which are only read, so the speed should grow with the
+ *    number of cores.
+ ************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "skeet.h"
+#include "bot.h"
+#include "jobs.h"
+using namespace std;
+
+#define WIDTH  800.0
+#define HEIGHT 800.0
+
+#define GAMES_PER_CHUNK 64   // games each thread takes at a time
+
+/*********************************************
+ * TALLY
+ * Enough about a set of numbers to know their
+ * mean, spread, and range without keeping them
+ *********************************************/
+class Tally
+{
+public:
+   Tally() : count(0), sum(0.0), sumSquares(0.0), least(0.0), most(0.0) {}
+
+   void add(double value)
+   {
+      least = count ? min(least, value) : value;
+      most  = count ? max(most,  value) : value;
+      count++;
+      sum += value;
+      sumSquares += value * value;
+   }
+   void add(const Tally & rhs)
+   {
+      if (rhs.count == 0)
+         return;
+      least = count ? min(least, rhs.least) : rhs.least;
+      most  = count ? max(most,  rhs.most)  : rhs.most;
+      count += rhs.count;
+      sum += rhs.sum;
+      sumSquares += rhs.sumSquares;
+   }
+
+   size_t getCount()    const { return count; }
+   double getMin()      const { return least; }
+   double getMax()      const { return most;  }
+   double getMean()     const { return count ? sum / count : 0.0; }
+   double getDeviation() const
+   {
+      if (count < 2)
+         return 0.0;
+      double mean = getMean();
+      return sqrt(max(0.0, sumSquares / count - mean * mean));
+   }
+
+private:
+   size_t count;
+   double sum;
+   double sumSquares;
+   double least;
+   double most;
+};
+
+/*********************************************
+ * RESULTS
+ * Everything we measure, for every level
+ *********************************************/
+struct LevelResults
+{
+   Tally score;
+   Tally hitRatio;
+   Tally escaped;
+   Tally peak;
+};
+struct Results
+{
+   Results(int numLevels = 0) : levels(numLevels + 1) {}
+
+   std::vector<LevelResults> levels;  // [0] is not used
+
+   void add(const Results & rhs)
+   {
+      for (size_t level = 1; level < levels.size(); level++)
+      {
+         levels[level].score.add(rhs.levels[level].score);
+         levels[level].hitRatio.add(rhs.levels[level].hitRatio);
+         levels[level].escaped.add(rhs.levels[level].escaped);
+         levels[level].peak.add(rhs.levels[level].peak);
+      }
+   }
+};
+
+/*********************************************
+ * PLAY
+ * One game from the first level to Game Over, noting
+ * where things stood when each level began and ended
+ *********************************************/
+void play(const string & botName, uint64_t seed, const Position & dimensions,
+          const Levels & levels, Results & results)
+{
+   Skeet skeet(dimensions, seed, &levels);
+   unique_ptr<Bot> bot = newBot(botName, ~seed);
+
+   int level = 0;            // the level being played, 0 between levels
+   int scoreStart = 0;
+   int killedStart = 0;
+   int missedStart = 0;
+   size_t onScreen = 0;      // live birds after the last frame of play
+   size_t peak = 0;
+
+   auto finish = [&]()
+   {
+      LevelResults & stats = results.levels[level];
+      int killed = skeet.getHitRatio().getKilled() - killedStart;
+      int missed = skeet.getHitRatio().getMissed() - missedStart;
+      stats.score.add(skeet.getScore().getPoints() - scoreStart);
+      if (killed + missed > 0)
+         stats.hitRatio.add(100.0 * killed / (killed + missed));
+      if (killed + missed + onScreen > 0)
+         stats.escaped.add(100.0 * missed / (killed + missed + onScreen));
+      stats.peak.add((double)peak);
+      level = 0;
+   };
+
+   while (!skeet.getTime().isGameOver())
+   {
+      skeet.interact(bot->play(skeet));
+      skeet.animate();
+
+      const Time & time = skeet.getTime();
+      if (time.isPlaying())
+      {
+         // the first frame of a level
+         if (level != time.level())
+         {
+            level = time.level();
+            scoreStart = skeet.getScore().getPoints();
+            killedStart = skeet.getHitRatio().getKilled();
+            missedStart = skeet.getHitRatio().getMissed();
+            peak = 0;
+         }
+         onScreen = skeet.getBirds().size();
+         peak = max(peak, skeet.getLiveObjects());
+      }
+      // the level just ended
+      else if (level != 0)
+         finish();
+   }
+   if (level != 0)
+      finish();
+}
+
+/*********************************************
+ * DISPLAY
+ * One line for every level
+ *********************************************/
+void display(const Results & results)
+{
+   cout << "level    games      score (sd)      hit ratio %     escaped %    peak objects\n";
+   for (size_t level = 1; level < results.levels.size(); level++)
+   {
+      const LevelResults & stats = results.levels[level];
+      cout << fixed << setprecision(1)
+           << setw(5)  << level
+           << setw(9)  << stats.score.getCount()
+           << setw(11) << stats.score.getMean()
+           << " (" << setw(5) << stats.score.getDeviation() << ")"
+           << setw(8)  << stats.hitRatio.getMean()
+           << " (" << setw(4) << stats.hitRatio.getDeviation() << ")"
+           << setw(7)  << stats.escaped.getMean()
+           << " (" << setw(4) << stats.escaped.getDeviation() << ")"
+           << setw(8)  << stats.peak.getMean()
+           << " max " << setprecision(0) << stats.peak.getMax() << endl;
+   }
+}
+
+/*********************************************
+ * WRITE CSV
+ * The same, for a spreadsheet
+ *********************************************/
+void writeCsv(ostream & out, const string & botName, const Results & results)
+{
+   for (size_t level = 1; level < results.levels.size(); level++)
+   {
+      const LevelResults & stats = results.levels[level];
+      out << botName << ',' << level << ',' << stats.score.getCount();
+      for (const Tally * tally : { &stats.score, &stats.hitRatio, &stats.escaped, &stats.peak })
+         out << ',' << tally->getMean() << ',' << tally->getDeviation()
+             << ',' << tally->getMin()  << ',' << tally->getMax();
+      out << '\n';
+   }
+}
+
+/*********************************************
+ * USAGE
+ *********************************************/
+int usage(const char * program)
+{
+   cerr << "usage: " << program << " [-n games] [-s seed] [-b bot[,bot...]] [-j threads] [-l levels] [-o file]\n"
+        << "   bots: " << BOT_NAMES << endl;
+   return 1;
+}
+
+/*********************************
+ * MAIN
+ * Play the games for every bot, then report
+ *********************************/
+int main(int argc, char ** argv)
+{
+   size_t numGames = 10000;
+   uint64_t seed = 1;
+   string botNames = "aim";
+   int numThreads = 0;
+   const char * csvFile = NULL;
+   Levels levels;
+
+   // read the command line
+   for (int i = 1; i < argc; i++)
+   {
+      if (i + 1 < argc && strcmp(argv[i], "-n") == 0)
+         numGames = strtoull(argv[++i], NULL, 10);
+      else if (i + 1 < argc && strcmp(argv[i], "-s") == 0)
+         seed = strtoull(argv[++i], NULL, 10);
+      else if (i + 1 < argc && strcmp(argv[i], "-b") == 0)
+         botNames = argv[++i];
+      else if (i + 1 < argc && strcmp(argv[i], "-j") == 0)
+         numThreads = atoi(argv[++i]);
+      else if (i + 1 < argc && strcmp(argv[i], "-l") == 0)
+      {
+         if (!levels.load(argv[++i]))
+         {
+            cerr << levels.getError() << endl;
+            return 1;
+         }
+      }
+      else if (i + 1 < argc && strcmp(argv[i], "-o") == 0)
+         csvFile = argv[++i];
+      else
+         return usage(argv[0]);
+   }
+   vector<string> bots;
+   stringstream names(botNames);
+   for (string name; getline(names, name, ','); )
+   {
+      if (newBot(name) == nullptr)
+         return usage(argv[0]);
+      bots.push_back(name);
+   }
+   if (numGames == 0 || bots.empty() || numThreads < 0)
+      return usage(argv[0]);
+
+   ofstream csv;
+   if (csvFile)
+   {
+      csv.open(csvFile);
+      if (!csv.is_open())
+      {
+         cerr << "cannot write " << csvFile << endl;
+         return 1;
+      }
+      csv << "bot,level,games";
+      for (const char * name : { "score", "hit_ratio", "escaped", "peak" })
+         csv << ',' << name << "_mean," << name << "_sd," << name << "_min," << name << "_max";
+      csv << '\n';
+   }
+
+   Position dimensions(WIDTH, HEIGHT);
+
+   JobSystem jobs(numThreads);
+   for (const string & botName : bots)
+   {
+      size_t numChunks = (numGames + GAMES_PER_CHUNK - 1) / GAMES_PER_CHUNK;
+      vector<Results> chunks(numChunks, Results(levels.size()));
+      auto begin = chrono::steady_clock::now();
+      jobs.parallelFor(numGames, GAMES_PER_CHUNK,
+                       [&](size_t chunk, size_t first, size_t last)
+      {
+         for (size_t game = first; game < last; game++)
+            play(botName, seed + game, dimensions, levels, chunks[chunk]);
+      });
+      Results results(levels.size());
+      for (const Results & chunk : chunks)
+         results.add(chunk);
+      double seconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+
+      cout << "bot " << botName << ": " << numGames << " games from seed " << seed
+           << " in " << fixed << setprecision(2) << seconds << " seconds on "
+           << jobs.getThreads() << " threads (" << setprecision(0)
+           << numGames / seconds << " games/sec)\n";
+      display(results);
+      cout << endl;
+      if (csv.is_open())
+         writeCsv(csv, botName, results);
+   }
+
+   return 0;
+}
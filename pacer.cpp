@@ -0,0 +1,176 @@
+/***********************************************************************
+ * Source File:
+ *    PACER : Keep the frames coming at a steady rate
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    Sleeping, spinning, and measuring
+ ************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <thread>
+#include "pacer.h"
+using namespace std;
+using namespace std::chrono;
+
+// start by spinning for the last two milliseconds; never more than ten
+#define SPIN_START microseconds(2000)
+#define SPIN_MOST  microseconds(10000)
+
+/*********************************************
+ * PACER constructor
+ *********************************************/
+Pacer::Pacer(double framesPerSecond) :
+   spin(SPIN_START), accumulated(0), numFrames(0)
+{
+   setFramesPerSecond(framesPerSecond);
+   due = lastStep = lastFrame = Clock::now();
+   for (double & frame : history)
+      frame = 0.0;
+}
+
+/*********************************************
+ * PACER : SET FRAMES PER SECOND
+ *********************************************/
+void Pacer::setFramesPerSecond(double framesPerSecond)
+{
+   assert(framesPerSecond > 0.0);
+   period = duration_cast<Clock::duration>(duration<double>(1.0 / framesPerSecond));
+}
+
+/*********************************************
+ * PACER : GET FRAMES PER SECOND
+ *********************************************/
+double Pacer::getFramesPerSecond() const
+{
+   return 1.0 / duration<double>(period).count();
+}
+
+/*********************************************
+ * PACER : WAIT
+ * Sleep through most of the wait, then spin. If we
+ * wake up late, spin longer next time; if we keep
+ * waking up on time, slowly spin less.
+ *********************************************/
+void Pacer::wait()
+{
+   due += period;
+   Clock::time_point now = Clock::now();
+
+   // more than a frame behind: start the schedule over from now
+   // rather than rushing frames out to catch up
+   if (now > due + period)
+      due = now;
+
+   // sleep
+   if (due - now > spin)
+   {
+      Clock::time_point wake = due - spin;
+      this_thread::sleep_until(wake);
+      Clock::duration late = Clock::now() - wake;
+      if (late > spin)
+         spin = min(Clock::duration(SPIN_MOST), late + late / 4);
+      else
+         spin = max(Clock::duration(microseconds(100)), spin - spin / 64);
+   }
+
+   // spin
+   while (Clock::now() < due)
+      this_thread::yield();
+
+   // measure
+   now = Clock::now();
+   if (numFrames > 0)
+      history[numFrames % PACER_HISTORY] = duration<double, milli>(now - lastFrame).count();
+   lastFrame = now;
+   numFrames++;
+}
+
+/*********************************************
+ * PACER : STEPS DUE
+ * The fixed-timestep accumulator
+ *********************************************/
+int Pacer::stepsDue(int most, Clock::time_point now)
+{
+   accumulated += now - lastStep;
+   lastStep = now;
+
+   int steps = 0;
+   while (accumulated >= period && steps < most)
+   {
+      accumulated -= period;
+      steps++;
+   }
+
+   // too far behind to ever catch up: let it go. Exactly [most] due
+   // is not behind, and keeps the part of a step left over
+   if (steps == most && accumulated >= period)
+      accumulated = Clock::duration(0);
+   return steps;
+}
+
+/*********************************************
+ * PACER : GET STEP TIME
+ * Whatever is left in the accumulator came after the
+ * latest step, and each step before it one period earlier
+ *********************************************/
+Pacer::Clock::time_point Pacer::getStepTime(int stepsLeft) const
+{
+   return lastStep - accumulated - stepsLeft * period;
+}
+
+/*********************************************
+ * PACER : GET ALPHA
+ *********************************************/
+double Pacer::getAlpha() const
+{
+   return min(1.0, duration<double>(accumulated).count() /
+                   duration<double>(period).count());
+}
+
+/*********************************************
+ * PACER : GET FRAME TIME
+ *********************************************/
+double Pacer::getFrameTime() const
+{
+   size_t count = min(numFrames > 0 ? numFrames - 1 : 0, (size_t)PACER_HISTORY);
+   if (count == 0)
+      return 0.0;
+   double sum = 0.0;
+   for (size_t i = 0; i < count; i++)
+      sum += history[(numFrames - 1 - i) % PACER_HISTORY];
+   return sum / count;
+}
+
+/*********************************************
+ * PACER : GET JITTER
+ *********************************************/
+double Pacer::getJitter() const
+{
+   size_t count = min(numFrames > 0 ? numFrames - 1 : 0, (size_t)PACER_HISTORY);
+   if (count == 0)
+      return 0.0;
+   double mean = getFrameTime();
+   double sum = 0.0;
+   for (size_t i = 0; i < count; i++)
+   {
+      double difference = history[(numFrames - 1 - i) % PACER_HISTORY] - mean;
+      sum += difference * difference;
+   }
+   return sqrt(sum / count);
+}
+
+/*********************************************
+ * PACER : GET WORST JITTER
+ *********************************************/
+double Pacer::getWorstJitter() const
+{
+   size_t count = min(numFrames > 0 ? numFrames - 1 : 0, (size_t)PACER_HISTORY);
+   double target = duration<double, milli>(period).count();
+   double worst = 0.0;
+   for (size_t i = 0; i < count; i++)
+      worst = max(worst, fabs(history[(numFrames - 1 - i) % PACER_HISTORY] - target));
+   return worst;
+}
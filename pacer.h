@@ -0,0 +1,76 @@
+/***********************************************************************
+ * Header File:
+ *    PACER : Keep the frames coming at a steady rate
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The window asks the pacer to wait until the next frame is due. The
+ *    pacer works in wall time from std::chrono::steady_clock, so it
+ *    does not drift when the processor is busy the way clock() (which
+ *    counts processor time) did.
+ *
+ *    Frames are due on a fixed schedule: one period after the last one
+ *    was due, not one period after we got around to it, so small delays
+ *    do not add up. To wait, the pacer sleeps until it is nearly time
+ *    and then spins for the last stretch. How long that stretch is
+ *    adapts to how late the operating system wakes us up, so the wait
+ *    is accurate to well under a millisecond without burning a core.
+ *
+ *    The pacer also keeps track of how long each frame really took so
+ *    the jitter can be reported.
+ ************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#define PACER_HISTORY 120      // frames of history for the statistics
+
+/*********************************************
+ * PACER
+ * Wait for the next frame, and measure how well we did
+ *********************************************/
+class Pacer
+{
+public:
+   typedef std::chrono::steady_clock Clock;
+
+   Pacer(double framesPerSecond = 30.0);
+
+   // how fast should the frames come?
+   void setFramesPerSecond(double framesPerSecond);
+   double getFramesPerSecond() const;
+
+   // wait until the next frame is due
+   void wait();
+
+   // how many fixed steps of one period have passed since the last
+   // call, as of [now]. A caller that runs one update per step stays in
+   // time with the wall clock even when a frame is late. Never more than
+   // [most].
+   int stepsDue(int most = 5, Clock::time_point now = Clock::now());
+
+   // when one of the steps from the last stepsDue() was due. [stepsLeft]
+   // is how many of them come after it, so 0 is the latest
+   Clock::time_point getStepTime(int stepsLeft = 0) const;
+
+   // how far we are into the next step, from 0 up to 1. Used to draw
+   // between the last two steps when frames come faster than steps.
+   double getAlpha() const;
+
+   // statistics over the recent frames, in milliseconds
+   double getFrameTime() const;     // average time between frames
+   double getJitter() const;        // standard deviation of the above
+   double getWorstJitter() const;   // furthest any frame was from the period
+
+private:
+   Clock::duration period;          // time between frames
+   Clock::time_point due;           // when the next frame is due
+   Clock::duration spin;            // how long before [due] to stop sleeping
+   Clock::time_point lastStep;      // where the step accumulator is up to
+   Clock::duration accumulated;     // time not yet handed out as steps
+   Clock::time_point lastFrame;     // when the previous frame went out
+   double history[PACER_HISTORY];   // milliseconds between recent frames
+   size_t numFrames;                // how many frames have gone out
+};
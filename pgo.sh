@@ -0,0 +1,101 @@
+#!/bin/sh
+#######################################################################
+# PGO : Build Skeet optimized with a profile of real games
+# Author:
+#    Br. Helfrich
+# Summary:
+#    The birds and bullets are already called as their own kind, so what
+#    is left to gain is across files and inside branches. Link-time
+#    optimization can inline the small functions of one file (Position,
+#    Random, the pools) into the loops of another, and a profile tells
+#    the compiler which way the branches of a frame usually go, which
+#    loops are hot, and which code is cold enough to move out of the way.
+#    This script:
+#
+#      1. builds the plain Release build (the release preset)
+#      2. builds the instrumented build (pgo-generate)
+#      3. trains it on headless games that play all four levels to Game
+#         Over, with both bots, and plays back a recorded game along with
+#         any replays given on the command line
+#      4. rebuilds with the profile (pgo-use)
+#      5. checks the optimized build plays exactly the same games, then
+#         reports frames/sec for both builds and the speedup
+#
+#    pgo.sh [replay.skrp ...]
+#
+#    The training games and the games we time use different seeds so the
+#    build is not measured on the exact games it was trained on. The window
+#    cannot be trained without a display, so the renderer is compiled
+#    without a profile. Set JOBS to limit the parallel build.
+#######################################################################
+
+set -e
+cd "$(dirname "$0")"
+
+JOBS=${JOBS:-$(nproc)}
+PROFILE=build/pgo-profile
+TRAIN_GAMES=40
+TIME_GAMES=300
+TIME_SEED=7
+
+# build [preset] from scratch so an old profile is never mixed in
+build()
+{
+   cmake --preset "$1" > /dev/null
+   cmake --build --preset "$1" -j "$JOBS" --clean-first > /dev/null
+}
+
+# the best frames/sec of three runs of [skeet-batch] with [bot]
+framesPerSecond()
+{
+   for run in 1 2 3; do
+      "$1" -n $TIME_GAMES -s $TIME_SEED -b "$2" | awk '/^frames\/sec:/ { print $2 }'
+   done | sort -g | tail -n 1
+}
+
+# everything about the games but how long they took
+results()
+{
+   "$1" -n $TIME_GAMES -s $TIME_SEED -b "$2" | grep -v -e seconds -e /sec
+}
+
+echo "building release"
+build release
+
+echo "building pgo-generate"
+rm -rf "$PROFILE"
+build pgo-generate
+
+echo "training"
+TRAIN=build/pgo-generate
+$TRAIN/skeet-batch -n $TRAIN_GAMES -s 1000 -b aim -w $TRAIN/train.skrp > /dev/null
+$TRAIN/skeet-batch -n $TRAIN_GAMES -s 2000 -b random > /dev/null
+$TRAIN/skeet-batch -n $TRAIN_GAMES -s 3000 -b aim -r > /dev/null
+$TRAIN/skeet-replay $TRAIN/train.skrp -x 20 > /dev/null
+for replay in "$@"; do
+   $TRAIN/skeet-replay "$replay" > /dev/null
+done
+
+# Clang leaves raw profiles to be merged; GCC's are ready to use
+if ls "$PROFILE"/*.profraw > /dev/null 2>&1; then
+   llvm-profdata merge -o "$PROFILE/default.profdata" "$PROFILE"/*.profraw
+fi
+
+echo "building pgo-use"
+build pgo-use
+
+for bot in aim random; do
+   if [ "$(results build/release/skeet-batch $bot)" != "$(results build/pgo-use/skeet-batch $bot)" ]; then
+      echo "pgo-use does not play the same games as release with the $bot bot" >&2
+      exit 1
+   fi
+done
+
+echo
+printf "%-8s %14s %14s %9s\n" bot "release f/s" "pgo-use f/s" speedup
+for bot in aim random; do
+   release=$(framesPerSecond build/release/skeet-batch $bot)
+   optimized=$(framesPerSecond build/pgo-use/skeet-batch $bot)
+   printf "%-8s %14.0f %14.0f %8.2fx\n" $bot "$release" "$optimized" \
+          "$(echo "$optimized $release" | awk '{ print $1 / $2 }')"
+done
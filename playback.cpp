@@ -0,0 +1,106 @@
+/***********************************************************************
+ * Source File:
+ *    PLAYBACK : Play a recorded game again without a window
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The file that contains main() for skeet-replay. It reads a replay
+ *    written by the game (skeet -w) or by skeet-batch -w, plays it as
+ *    fast as it will go, and reports how the game ended and how long it
+ *    took. The same replay always ends the same way, so this is how a
+ *    bug report is reproduced and how two builds are timed on exactly
+ *    the same work.
+ *
+ *    skeet-replay file [-x times] [-l levels]
+ *
+ *    A replay does not hold the levels, so a game played with -l has to
+ *    be played back with the same -l.
+ ************************************************************************/
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include "replay.h"
+#include "skeet.h"
+using namespace std;
+
+/*********************************************
+ * USAGE
+ *********************************************/
+int usage(const char * program)
+{
+   cerr << "usage: " << program << " file [-x times] [-l levels]\n";
+   return 1;
+}
+
+/*********************************
+ * MAIN
+ * Play the replay, then report
+ *********************************/
+int main(int argc, char ** argv)
+{
+   const char * fileName = NULL;
+   int times = 1;
+   Levels levels;
+
+   // read the command line
+   for (int i = 1; i < argc; i++)
+   {
+      if (i + 1 < argc && strcmp(argv[i], "-x") == 0)
+         times = atoi(argv[++i]);
+      else if (i + 1 < argc && strcmp(argv[i], "-l") == 0)
+      {
+         if (!levels.load(argv[++i]))
+         {
+            cerr << levels.getError() << endl;
+            return 1;
+         }
+      }
+      else if (argv[i][0] != '-' && fileName == NULL)
+         fileName = argv[i];
+      else
+         return usage(argv[0]);
+   }
+   if (fileName == NULL || times <= 0)
+      return usage(argv[0]);
+
+   Replay replay;
+   if (!replay.load(fileName))
+   {
+      cerr << "cannot read replay " << fileName << endl;
+      return 1;
+   }
+
+   // every time through is a fresh game from the same seed
+   Position dimensions(replay.getDimensions());
+   long long numFrames = 0;
+   int score = 0;
+   int killed = 0;
+   int missed = 0;
+   auto begin = chrono::steady_clock::now();
+   for (int i = 0; i < times; i++)
+   {
+      Skeet skeet(dimensions, replay.getSeed(), &levels);
+      numFrames += replay.play(skeet);
+      score  = skeet.getScore().getPoints();
+      killed = skeet.getHitRatio().getKilled();
+      missed = skeet.getHitRatio().getMissed();
+   }
+   double seconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+
+   // report
+   cout << "replay:      " << fileName << endl;
+   cout << "seed:        " << replay.getSeed() << endl;
+   cout << "frames:      " << replay.size() << " x " << times << endl;
+   cout << "score:       " << score << endl;
+   cout << "birds:       " << killed << " killed, " << missed << " missed" << endl;
+   cout << fixed << setprecision(3);
+   cout << "seconds:     " << seconds << endl;
+   cout << setprecision(1);
+   cout << "frames/sec:  " << numFrames / seconds << endl;
+   cout << "speed:       " << numFrames / seconds / (double)FRAMES_PER_SECOND << "x real time" << endl;
+
+   return 0;
+}
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "position.h"
+#include "random.h"
 
  /*********************************************
   * POINTS
@@ -19,12 +20,18 @@
 class Points
 {
 public:
-   Points(const Position& pt, int value);
-   void show() const;
-   void update();
+   Points(const Position & dimensions, const Position & pt, int value, Random & random);
+   void update(Random & random);
    bool isDead() const {return age <= 0.0; }
+
+   // getters
+   Position getPosition() const { return pt;    }
+   Position getLastPosition() const { return ptLast; }
+   int getValue()         const { return value; }
+   float getAge()         const { return age;   }
 private:
    Position pt;
+   Position ptLast;
    Velocity v;
    int value;
    float age;
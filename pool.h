@@ -0,0 +1,212 @@
+/***********************************************************************
+ * Header File:
+ *    POOL : Contiguous storage for the things in the game
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The birds, bullets, and points live in pools instead of
+ *    lists of pointers. A pool keeps its elements side by side in one
+ *    block of memory and holds on to that memory when elements die, so
+ *    once a game has warmed up adding and removing costs no allocation
+ *    and walking the pool is a straight walk through memory.
+ *
+ *    A pool owns its elements: when one is removed or the pool is
+ *    cleared it is destroyed right there, so nothing can leak. size()
+ *    is the number of live elements and bytes() is the memory the pool
+ *    has set aside for them.
+ *
+ *    Pool<T> holds one kind of thing. PolyPool<Base, Kinds...> holds any
+ *    of a closed set of kinds (for example the four birds) in the same
+ *    contiguous block and hands each one back as a Base &. Its forEach()
+ *    hands each one back as its own kind instead, so a call on it is
+ *    decided by the compiler (the kinds are final) rather than a virtual
+ *    call, and can be inlined.
+ ************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+/*********************************************
+ * POOL
+ * Contiguous storage of one kind of element
+ *********************************************/
+template <class T>
+class Pool
+{
+public:
+   typedef typename std::vector<T>::iterator       iterator;
+   typedef typename std::vector<T>::const_iterator const_iterator;
+
+   Pool(size_t capacity = 0) { elements.reserve(capacity); }
+
+   // add a new element to the end of the pool
+   template <class ... Args>
+   T & add(Args && ... args)
+   {
+      elements.emplace_back(std::forward<Args>(args)...);
+      return elements.back();
+   }
+
+   // remove every element the predicate says is dead. This keeps the
+   // order of the survivors and the memory of the pool.
+   template <class Predicate>
+   void removeIf(Predicate isDead)
+   {
+      elements.erase(std::remove_if(elements.begin(), elements.end(), isDead),
+                     elements.end());
+   }
+
+   // remove everything but keep the memory
+   void clear() { elements.clear(); }
+
+   // getters
+   size_t size()     const { return elements.size();     }
+   bool   empty()    const { return elements.empty();    }
+   size_t capacity() const { return elements.capacity(); }
+   size_t bytes()    const { return capacity() * sizeof(T); }
+   T       & operator [] (size_t i)       { assert(i < size()); return elements[i]; }
+   const T & operator [] (size_t i) const { assert(i < size()); return elements[i]; }
+
+   // walk through the pool in order
+   iterator       begin()       { return elements.begin(); }
+   iterator       end()         { return elements.end();   }
+   const_iterator begin() const { return elements.begin(); }
+   const_iterator end()   const { return elements.end();   }
+
+private:
+   std::vector<T> elements;
+};
+
+/*********************************************
+ * POLY POOL
+ * Contiguous storage of a closed set of kinds that share a base class.
+ * Every slot is big enough for the biggest kind.
+ *********************************************/
+template <class Base, class ... Kinds>
+class PolyPool
+{
+   typedef std::variant<Kinds...> Slot;
+
+   // find the base class of whatever is in a slot
+   static Base & base(Slot & slot)
+   {
+      return std::visit([](auto & kind) -> Base & { return kind; }, slot);
+   }
+   static const Base & base(const Slot & slot)
+   {
+      return std::visit([](const auto & kind) -> const Base & { return kind; }, slot);
+   }
+
+   /*********************************************
+    * ITERATOR
+    * Walk through the slots, seeing each one as a Base
+    *********************************************/
+   template <class Value, class SlotIterator>
+   class Iterator
+   {
+   public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Value                     value_type;
+      typedef std::ptrdiff_t            difference_type;
+      typedef Value *                   pointer;
+      typedef Value &                   reference;
+
+      Iterator(SlotIterator it) : it(it) {}
+      Value & operator *  () const { return base(*it);  }
+      Value * operator -> () const { return &base(*it); }
+      Iterator & operator ++ ()    { ++it; return *this; }
+      Iterator operator ++ (int)   { Iterator tmp(*this); ++it; return tmp; }
+      bool operator == (const Iterator & rhs) const { return it == rhs.it; }
+      bool operator != (const Iterator & rhs) const { return it != rhs.it; }
+   private:
+      SlotIterator it;
+   };
+
+   // call [f] on whatever kind is in the slot: a chain of ifs the
+   // compiler can inline into, where std::visit is a table of pointers
+   template <size_t I = 0, class SlotType, class Function>
+   static void call(SlotType & slot, Function & f)
+   {
+      if constexpr (I + 1 < sizeof...(Kinds))
+      {
+         if (slot.index() != I)
+            return call<I + 1>(slot, f);
+      }
+      f(*std::get_if<I>(&slot));
+   }
+
+public:
+   typedef Iterator<Base,       typename std::vector<Slot>::iterator>       iterator;
+   typedef Iterator<const Base, typename std::vector<Slot>::const_iterator> const_iterator;
+
+   PolyPool(size_t capacity = 0) { slots.reserve(capacity); }
+
+   // add a new element of a given kind to the end of the pool
+   template <class Kind, class ... Args>
+   Kind & add(Args && ... args)
+   {
+      slots.emplace_back(std::in_place_type<Kind>, std::forward<Args>(args)...);
+      return std::get<Kind>(slots.back());
+   }
+
+   // remove every element the predicate says is dead. This keeps the
+   // order of the survivors and the memory of the pool.
+   template <class Predicate>
+   void removeIf(Predicate isDead)
+   {
+      slots.erase(std::remove_if(slots.begin(), slots.end(),
+                                 [&isDead](const Slot & slot) { return isDead(base(slot)); }),
+                  slots.end());
+   }
+
+   // remove everything but keep the memory
+   void clear() { slots.clear(); }
+
+   // getters
+   size_t size()     const { return slots.size();     }
+   bool   empty()    const { return slots.empty();    }
+   size_t capacity() const { return slots.capacity(); }
+   size_t bytes()    const { return capacity() * sizeof(Slot); }
+   Base       & operator [] (size_t i)       { assert(i < size()); return base(slots[i]); }
+   const Base & operator [] (size_t i) const { assert(i < size()); return base(slots[i]); }
+
+   // call [f] on every element, in order, as its own kind
+   template <class Function>
+   void forEach(Function f)
+   {
+      for (Slot & slot : slots)
+         call(slot, f);
+   }
+   template <class Function>
+   void forEach(Function f) const
+   {
+      for (const Slot & slot : slots)
+         call(slot, f);
+   }
+
+   // the same, for the elements in [begin, end)
+   template <class Function>
+   void forEach(size_t begin, size_t end, Function f)
+   {
+      assert(begin <= end && end <= size());
+      for (size_t i = begin; i < end; i++)
+         call(slots[i], f);
+   }
+
+   // walk through the pool in order
+   iterator       begin()       { return iterator(slots.begin());       }
+   iterator       end()         { return iterator(slots.end());         }
+   const_iterator begin() const { return const_iterator(slots.begin()); }
+   const_iterator end()   const { return const_iterator(slots.end());   }
+
+private:
+   std::vector<Slot> slots;
+};
@@ -113,7 +113,7 @@ public:
       dy *= mult;
       return *this;
    }
-   Velocity operator* (double mult)
+   Velocity operator* (double mult) const
    {
       Velocity v(*this);
       v *= mult;
@@ -141,5 +141,13 @@ std::istream & operator >> (std::istream & in,        Position & pt);
 inline double max(double x, double y) { return (x > y) ? x : y; }
 inline double min(double x, double y) { return (x > y) ? y : x; }
 
+// how close two things moving in a straight line get during one frame
 double minimumDistance(const Position & pt1, const Velocity & v1,
                        const Position & pt2, const Velocity & v2);
+
+// do two things moving in a straight line come within [distance] of each
+// other during one frame? If so, [time] is when they first touch: 0.0 is
+// now and 1.0 is after the full velocity has been added
+bool timeOfImpact(const Position & pt1, const Velocity & v1,
+                  const Position & pt2, const Velocity & v2,
+                  double distance, double & time);
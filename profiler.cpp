@@ -0,0 +1,168 @@
+/***********************************************************************
+ * Source File:
+ *    PROFILER : Where does a frame go?
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    Everything about the profiler that is not a timer
+ ************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+#include "profiler.h"
+
+using namespace std;
+using namespace std::chrono;
+
+/*********************************************
+ * GET NAME
+ * What to call a stage in the overlay and the CSV file
+ *********************************************/
+const char * getName(Stage stage)
+{
+   switch (stage)
+   {
+      case STAGE_INTERACT:         return "interact";
+      case STAGE_SPAWN:            return "spawn";
+      case STAGE_ADVANCE:          return "advance";
+      case STAGE_MOVE:             return "move";
+      case STAGE_EFFECTS:          return "effects";
+      case STAGE_HITS:             return "hits";
+      case STAGE_REMOVE_BIRDS:     return "remove birds";
+      case STAGE_REMOVE_BULLETS:   return "remove bullets";
+      case STAGE_REMOVE_POINTS:    return "remove points";
+      case STAGE_DRAW_BACKGROUND:  return "draw background";
+      case STAGE_DRAW_POINTS:      return "draw points";
+      case STAGE_DRAW_EFFECTS:     return "draw effects";
+      case STAGE_DRAW_BULLETS:     return "draw bullets";
+      case STAGE_DRAW_BIRDS:       return "draw birds";
+      case STAGE_DRAW_TEXT:        return "draw text";
+      case STAGE_DRAW_FLUSH:       return "draw flush";
+      default:                     return "unknown";
+   }
+}
+
+/*********************************************
+ * PROFILER constructor
+ *********************************************/
+Profiler::Profiler() : enabled(false), numFrames(0)
+{
+   for (int stage = 0; stage < NUM_STAGES; stage++)
+   {
+      current[stage] = Clock::duration(0);
+      ran[stage] = false;
+      numSamples[stage] = 0;
+      for (double & sample : history[stage])
+         sample = 0.0;
+   }
+}
+
+/*********************************************
+ * PROFILER : OPEN CSV
+ * Start the file with a line naming the columns
+ *********************************************/
+bool Profiler::openCsv(const char * fileName)
+{
+   csv.open(fileName);
+   if (!csv.is_open())
+      return false;
+   csv << "frame";
+   for (int stage = 0; stage < NUM_STAGES; stage++)
+      csv << ',' << getName((Stage)stage);
+   csv << '\n';
+   return true;
+}
+
+/*********************************************
+ * PROFILER : ADD
+ * A stage can run more than once in a frame, such as
+ * when the simulation takes two steps to catch up
+ *********************************************/
+void Profiler::add(Stage stage, Clock::duration elapsed)
+{
+   assert(stage >= 0 && stage < NUM_STAGES);
+   current[stage] += elapsed;
+   ran[stage] = true;
+}
+
+/*********************************************
+ * PROFILER : END FRAME
+ * A stage that did not run this frame leaves its
+ * statistics alone and its column in the CSV file empty
+ *********************************************/
+void Profiler::endFrame()
+{
+   if (csv.is_open())
+      csv << numFrames;
+
+   for (int stage = 0; stage < NUM_STAGES; stage++)
+   {
+      if (csv.is_open())
+         csv << ',';
+      if (!ran[stage])
+         continue;
+
+      double ms = duration<double, milli>(current[stage]).count();
+      history[stage][numSamples[stage] % PROFILER_HISTORY] = ms;
+      numSamples[stage]++;
+      if (csv.is_open())
+         csv << ms;
+
+      current[stage] = Clock::duration(0);
+      ran[stage] = false;
+   }
+
+   if (csv.is_open())
+      csv << '\n';
+   numFrames++;
+}
+
+/*********************************************
+ * PROFILER : COUNT
+ * How many frames of history a stage has
+ *********************************************/
+size_t Profiler::count(Stage stage) const
+{
+   return min(numSamples[stage], (size_t)PROFILER_HISTORY);
+}
+
+/*********************************************
+ * PROFILER : GET MIN
+ *********************************************/
+double Profiler::getMin(Stage stage) const
+{
+   size_t n = count(stage);
+   if (n == 0)
+      return 0.0;
+   return *min_element(history[stage], history[stage] + n);
+}
+
+/*********************************************
+ * PROFILER : GET AVERAGE
+ *********************************************/
+double Profiler::getAverage(Stage stage) const
+{
+   size_t n = count(stage);
+   if (n == 0)
+      return 0.0;
+   double sum = 0.0;
+   for (size_t i = 0; i < n; i++)
+      sum += history[stage][i];
+   return sum / n;
+}
+
+/*********************************************
+ * PROFILER : GET P99
+ * The time 99 frames in 100 come in under
+ *********************************************/
+double Profiler::getP99(Stage stage) const
+{
+   size_t n = count(stage);
+   if (n == 0)
+      return 0.0;
+   double sorted[PROFILER_HISTORY];
+   copy(history[stage], history[stage] + n, sorted);
+   size_t rank = (n * 99 + 99) / 100 - 1;
+   nth_element(sorted, sorted + rank, sorted + n);
+   return sorted[rank];
+}
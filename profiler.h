@@ -0,0 +1,119 @@
+/***********************************************************************
+ * Header File:
+ *    PROFILER : Where does a frame go?
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    Scoped timers around the stages of a frame: handling input, each
+ *    part of animating the game, and each group of things drawn. Every
+ *    stage adds up its time over the frame; endFrame() then keeps that
+ *    frame's numbers so the minimum, average, and 99th percentile over
+ *    the recent frames can be shown, and writes them as one line of a
+ *    CSV file if one is open.
+ *
+ *    A disabled profiler (the default) costs one test per timer. None of
+ *    this changes the game, so it does not matter to a replay.
+ ************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+
+#define PROFILER_HISTORY 300   // frames of history for the statistics
+
+/*********************************************
+ * STAGE
+ * The parts of a frame we time
+ *********************************************/
+enum Stage
+{
+   STAGE_INTERACT,         // input, recording, and the gun
+   STAGE_SPAWN,            // new birds
+   STAGE_ADVANCE,          // birds
+   STAGE_MOVE,             // bullets
+   STAGE_EFFECTS,          // fragments, trails, and points
+   STAGE_HITS,             // every bird against every bullet
+   STAGE_REMOVE_BIRDS,     // score the dead birds and take them out
+   STAGE_REMOVE_BULLETS,   // explode the dead bullets and take them out
+   STAGE_REMOVE_POINTS,    // take out the expired points
+   STAGE_DRAW_BACKGROUND,  // background, bullseye, and gun
+   STAGE_DRAW_POINTS,
+   STAGE_DRAW_EFFECTS,
+   STAGE_DRAW_BULLETS,
+   STAGE_DRAW_BIRDS,
+   STAGE_DRAW_TEXT,        // score, time, hit ratio, and this overlay
+   STAGE_DRAW_FLUSH,       // handing the vertices to OpenGL
+   NUM_STAGES
+};
+
+const char * getName(Stage stage);
+
+/*********************************************
+ * PROFILER
+ * Add up the time spent in each stage
+ *********************************************/
+class Profiler
+{
+public:
+   typedef std::chrono::steady_clock Clock;
+
+   Profiler();
+
+   // timers only run when the profiler is enabled
+   void setEnabled(bool enabled) { this->enabled = enabled; }
+   bool isEnabled() const        { return enabled;          }
+
+   // write one line per frame to [fileName]. False if it cannot be opened
+   bool openCsv(const char * fileName);
+   bool isLogging() const { return csv.is_open(); }
+
+   // count [elapsed] against [stage] in this frame
+   void add(Stage stage, Clock::duration elapsed);
+
+   // this frame is done: keep its numbers and start the next one
+   void endFrame();
+
+   // statistics over the recent frames that ran [stage], in milliseconds
+   double getMin(Stage stage) const;
+   double getAverage(Stage stage) const;
+   double getP99(Stage stage) const;
+   size_t getFrames() const { return numFrames; }
+
+private:
+   size_t count(Stage stage) const;
+
+   bool enabled;
+   Clock::duration current[NUM_STAGES];   // this frame so far
+   bool ran[NUM_STAGES];                  // did the stage run this frame?
+   double history[NUM_STAGES][PROFILER_HISTORY];  // ms, recent frames
+   size_t numSamples[NUM_STAGES];         // frames each stage has run
+   size_t numFrames;                      // frames ended
+   std::ofstream csv;
+};
+
+/*********************************************
+ * PROFILE SCOPE
+ * Time from here to the end of the block
+ *********************************************/
+class ProfileScope
+{
+public:
+   ProfileScope(Profiler * profiler, Stage stage) :
+      profiler(profiler && profiler->isEnabled() ? profiler : NULL), stage(stage)
+   {
+      if (this->profiler)
+         start = Profiler::Clock::now();
+   }
+   ~ProfileScope()
+   {
+      if (profiler)
+         profiler->add(stage, Profiler::Clock::now() - start);
+   }
+
+private:
+   Profiler * profiler;
+   Stage stage;
+   Profiler::Clock::time_point start;
+};
@@ -0,0 +1,77 @@
+/***********************************************************************
+ * Header File:
+ *    RANDOM : The random numbers of one game
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    Every random number in a game comes from that game's Random, a
+ *    xoshiro256** generator. Nothing is shared between games, so two
+ *    games can run side by side, and a game started from the same seed
+ *    and given the same input plays out exactly the same way.
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+
+/*********************************************
+ * RANDOM
+ * A small, fast, seedable random number generator
+ *********************************************/
+class Random
+{
+public:
+   Random(uint64_t seed = 0) { this->seed(seed); }
+
+   // start over from a seed. Any seed is fine, even 0.
+   void seed(uint64_t seed)
+   {
+      // spread the seed over the whole state with splitmix64
+      for (int i = 0; i < 4; i++)
+      {
+         seed += 0x9e3779b97f4a7c15ULL;
+         uint64_t z = seed;
+         z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+         z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+         state[i] = z ^ (z >> 31);
+      }
+   }
+
+   // the next 64 random bits
+   uint64_t next()
+   {
+      uint64_t result = rotate(state[1] * 5, 7) * 9;
+      uint64_t t = state[1] << 17;
+      state[2] ^= state[0];
+      state[3] ^= state[1];
+      state[1] ^= state[2];
+      state[0] ^= state[3];
+      state[2] ^= t;
+      state[3] = rotate(state[3], 45);
+      return result;
+   }
+
+   // an integer where min <= num < max
+   int nextInt(int min, int max)
+   {
+      assert(min < max);
+      uint64_t range = (uint64_t)((int64_t)max - min);
+      return (int)(min + (int64_t)(((next() >> 32) * range) >> 32));
+   }
+
+   // a number where min <= num < max: 53 random bits over 2^53, so the
+   // percent never reaches 1 (though min + percent * (max - min) can
+   // still round up to max)
+   double nextDouble(double min, double max)
+   {
+      assert(min <= max);
+      double percent = (double)(next() >> 11) * (1.0 / 9007199254740992.0);
+      return min + percent * (max - min);
+   }
+
+private:
+   static uint64_t rotate(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+   uint64_t state[4];
+};
@@ -0,0 +1,335 @@
+/***********************************************************************
+ * Source File:
+ *    RENDERER : Draw the game on the screen
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The rendering layer. It reads the state of a Skeet game and
+ *    draws it with the primitives in uiDraw. Nothing in the simulation
+ *    knows this class exists.
+ ************************************************************************/
+
+#include <cstdio>
+#include <sstream>
+#include "renderer.h"
+#include "skeet.h"
+#include "uiDraw.h"
+#include "profiler.h"
+
+#ifdef _WIN32
+#define _USE_MATH_DEFINES
+#include <math.h>
+#endif // _WIN32
+
+using namespace std;
+
+/************************
+ * RENDERER INTERPOLATE
+ * [alpha] of the way from where something was at the
+ * start of the last frame to where it is now
+ ************************/
+Position Renderer::interpolate(const Position & last, const Position & now) const
+{
+   return Position(last.getX() + (now.getX() - last.getX()) * alpha,
+                   last.getY() + (now.getY() - last.getY()) * alpha);
+}
+
+/************************
+ * RENDERER DRAW LEVEL
+ * output everything that will be on the screen. The
+ * simulation steps less often than the screen is drawn,
+ * so everything that moves is drawn [alpha] of the way
+ * through its last step.
+ ************************/
+void Renderer::drawLevel(double alpha)
+{
+   this->alpha = alpha;
+   const Position & dimensions = skeet.getDimensions();
+
+   // output the background
+   {
+      ProfileScope scope(profiler, STAGE_DRAW_BACKGROUND);
+      drawBackground(dimensions, skeet.getTime().level() * .1, 0.0, 0.0);
+   
+      // draw the bullseye
+      if (skeet.isBullseye())
+         drawBullseye(dimensions, skeet.getGun().getAngle());
+
+      // output the gun
+      draw(skeet.getGun());
+   }
+         
+   // output the birds, bullets, and fragments
+   {
+      ProfileScope scope(profiler, STAGE_DRAW_POINTS);
+      for (auto& pts : skeet.getPoints())
+         draw(pts);
+   }
+   {
+      ProfileScope scope(profiler, STAGE_DRAW_EFFECTS);
+      draw(skeet.getEffects());
+   }
+   {
+      ProfileScope scope(profiler, STAGE_DRAW_BULLETS);
+      skeet.getBullets().forEach([this](const auto & bullet) { draw(bullet); });
+   }
+   {
+      ProfileScope scope(profiler, STAGE_DRAW_BIRDS);
+      skeet.getBirds().forEach([this](const auto & element) { draw(element); });
+   }
+   
+   // status
+   ProfileScope scope(profiler, STAGE_DRAW_TEXT);
+   drawText(Position(10,                         dimensions.getY() - 30), skeet.getScore().getText()   );
+   drawText(Position(dimensions.getX() / 2 - 30, dimensions.getY() - 30), skeet.getTime().getText()    );
+   drawText(Position(dimensions.getX() - 110,    dimensions.getY() - 30), skeet.getHitRatio().getText());
+}
+
+/************************
+ * RENDERER DRAW PROFILE
+ * one line per stage under the score: the fastest,
+ * average, and 99th percentile time in milliseconds
+ ************************/
+void Renderer::drawProfile()
+{
+   if (!profiler)
+      return;
+   ProfileScope scope(profiler, STAGE_DRAW_TEXT);
+   const Position & dimensions = skeet.getDimensions();
+
+   double y = dimensions.getY() - 60;
+   drawText(Position(10, y), "stage             min     avg     p99  (ms)", 0.6, 0.6, 0.6);
+   for (int i = 0; i < NUM_STAGES; i++)
+   {
+      Stage stage = (Stage)i;
+      char line[80];
+      snprintf(line, sizeof(line), "%-15s %7.3f %7.3f %7.3f", getName(stage),
+               profiler->getMin(stage), profiler->getAverage(stage),
+               profiler->getP99(stage));
+      y -= 16;
+      drawText(Position(10, y), line, 0.6, 0.6, 0.6);
+   }
+}
+
+/************************
+ * RENDERER DRAW STATUS
+ * place the status message on the center of the screen
+ ************************/
+void Renderer::drawStatus()
+{
+   const Position & dimensions = skeet.getDimensions();
+   const Time & time = skeet.getTime();
+
+   // output the text information
+   ostringstream sout;
+   if (time.isGameOver())
+   {
+      // draw the end of game message
+      drawText(Position(dimensions.getX() / 2 - 30, dimensions.getY() / 2 + 10),
+               "Game Over");
+
+      // draw end of game status
+      drawText(Position(dimensions.getX() / 2 - 30, dimensions.getY() / 2 - 10),
+               skeet.getScore().getText());
+   }
+   else
+   {
+      // output the status timer
+      drawTimer(dimensions, 1.0 - time.percentLeft(),
+                (time.level() - 0.0) * .1, 0.0, 0.0,
+                (time.level() - 1.0) * .1, 0.0, 0.0);
+
+      // draw the message giving a countdown
+      sout << "Level " << time.level()
+           << " begins in " << time.secondsLeft() << " seconds";
+      drawText(Position(dimensions.getX() / 2 - 110, dimensions.getY() / 2 - 10),
+               sout.str());
+   }
+}
+
+/*********************************************
+ * GUN DRAW
+ * Display the gun on the screen
+ *********************************************/
+void Renderer::draw(const Gun & gun)
+{
+   drawRectangle(gun.getPosition(), M_PI_2 - gun.getAngle(), 10.0, 100.0, 1.0, 1.0, 1.0);
+}
+
+/*********************************************
+ * POINTS DRAW
+ * Draw a points value on the screen
+ *********************************************/
+void Renderer::draw(const Points & points)
+{
+   int value = points.getValue();
+   if (value == 0)
+      return;
+
+   // set the color: green for a hit, red for a miss
+   double red   = (value <= 0 ? 1.0 : 0.0) * points.getAge();
+   double green = (value <= 0 ? 0.0 : 1.0) * points.getAge();
+
+   // draw the digits
+   int number = (value > 0 ? value : -value);
+   char text[3] = {};
+   int i = 0;
+   if (number / 10 != 0)
+      text[i++] = (char)(number / 10) + '0';
+   text[i] = (char)(number % 10) + '0';
+   drawText(where(points), text, red, green, 0.0);
+}
+
+/***************************************************************/
+/***************************************************************/
+/*                            BIRDS                            */
+/***************************************************************/
+/***************************************************************/
+
+/*********************************************
+ * STANDARD DRAW
+ * Draw a standard bird: blue center and white outline
+ *********************************************/
+void Renderer::draw(const Standard & bird)
+{
+   if (!bird.isDead())
+   {
+      Position pt = where(bird);
+      drawDisk(pt, bird.getRadius() - 0.0, 1.0, 1.0, 1.0); // white outline
+      drawDisk(pt, bird.getRadius() - 3.0, 0.0, 0.0, 1.0); // blue center
+   }
+}
+
+/*********************************************
+ * FLOATER DRAW
+ * Draw a floating bird: white center and blue outline
+ *********************************************/
+void Renderer::draw(const Floater & bird)
+{
+   if (!bird.isDead())
+   {
+      Position pt = where(bird);
+      drawDisk(pt, bird.getRadius() - 0.0, 0.0, 0.0, 1.0); // blue outline
+      drawDisk(pt, bird.getRadius() - 4.0, 1.0, 1.0, 1.0); // white center
+   }
+}
+
+/*********************************************
+ * CRAZY DRAW
+ * Draw a crazy bird: concentric circles in a course gradient
+ *********************************************/
+void Renderer::draw(const Crazy & bird)
+{
+   if (!bird.isDead())
+   {
+      Position pt = where(bird);
+      drawDisk(pt, bird.getRadius() * 1.0, 0.0, 0.0, 1.0); // bright blue outside
+      drawDisk(pt, bird.getRadius() * 0.8, 0.2, 0.2, 1.0);
+      drawDisk(pt, bird.getRadius() * 0.6, 0.4, 0.4, 1.0);
+      drawDisk(pt, bird.getRadius() * 0.4, 0.6, 0.6, 1.0);
+      drawDisk(pt, bird.getRadius() * 0.2, 0.8, 0.8, 1.0); // almost white inside
+   }
+}
+
+/*********************************************
+ * SINKER DRAW
+ * Draw a sinker bird: black center and dark blue outline
+ *********************************************/
+void Renderer::draw(const Sinker & bird)
+{
+   if (!bird.isDead())
+   {
+      Position pt = where(bird);
+      drawDisk(pt, bird.getRadius() - 0.0, 0.0, 0.0, 0.8);
+      drawDisk(pt, bird.getRadius() - 4.0, 0.0, 0.0, 0.0);
+   }
+}
+
+/***************************************************************/
+/***************************************************************/
+/*                           BULLETS                           */
+/***************************************************************/
+/***************************************************************/
+
+/*********************************************
+ * PELLET DRAW
+ * Draw a pellet - just a 3-pixel dot
+ *********************************************/
+void Renderer::draw(const Pellet & bullet)
+{
+   if (!bullet.isDead())
+      drawDot(where(bullet), 3.0, 1.0, 1.0, 0.0);
+}
+
+/*********************************************
+ * BOMB DRAW
+ * Draw a bomb - many dots to make it have a soft edge
+ *********************************************/
+void Renderer::draw(const Bomb & bullet)
+{
+   if (!bullet.isDead())
+   {
+      Position pt = where(bullet);
+      // Bomb actually has a gradient to cut out the harsh edges
+      drawDot(pt, bullet.getRadius() + 2.0, 0.50, 0.50, 0.00);
+      drawDot(pt, bullet.getRadius() + 1.0, 0.75, 0.75, 0.00);
+      drawDot(pt, bullet.getRadius() + 0.0, 0.87, 0.87, 0.00);
+      drawDot(pt, bullet.getRadius() - 1.0, 1.00, 1.00, 0.00);
+   }
+}
+
+/*********************************************
+ * SHRAPNEL DRAW
+ * Draw a fragment - a bright yellow dot
+ *********************************************/
+void Renderer::draw(const Shrapnel & bullet)
+{
+   if (!bullet.isDead())
+      drawDot(where(bullet), bullet.getRadius(), 1.0, 1.0, 0.0);
+}
+
+/*********************************************
+ * MISSILE DRAW
+ * Draw a missile - a line and a dot for the fins
+ *********************************************/
+void Renderer::draw(const Missile & bullet)
+{
+   if (!bullet.isDead())
+   {
+      Position pt = where(bullet);
+      // missile is a line with a dot at the end so it looks like fins.
+      Position ptNext(pt);
+      ptNext.add(bullet.getVelocity());
+      drawLine(pt, ptNext, 1.0, 1.0, 0.0);
+      drawDot(pt, 3.0, 1.0, 1.0, 1.0);
+   }
+}
+
+/***************************************************************/
+/***************************************************************/
+/*                           EFFECTS                           */
+/***************************************************************/
+/***************************************************************/
+
+/************************************************************************
+ * EFFECTS DRAW
+ * Fragments are dots and streeks and exhaust are lines, all
+ * fading to black with age. Only live particles are kept.
+ *************************************************************************/
+void Renderer::draw(const Effects & effects)
+{
+   const Fragments & fragments = effects.getFragments();
+   for (size_t i = 0; i < fragments.size(); i++)
+   {
+      double age = fragments.getAge(i);
+      drawDot(interpolate(fragments.getLastPosition(i), fragments.getPosition(i)),
+              fragments.getSize(i) * 2.0, age, age, age);
+   }
+
+   for (const Trails * trails : { &effects.getStreeks(), &effects.getExhaust() })
+      for (size_t i = 0; i < trails->size(); i++)
+      {
+         double age = trails->getAge(i);
+         drawLine(trails->getPosition(i), trails->getEnd(i), age, age, age);
+      }
+}
@@ -0,0 +1,75 @@
+/***********************************************************************
+ * Header File:
+ *    RENDERER : Draw the game on the screen
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The rendering layer. It reads the state of a Skeet game and
+ *    draws it with the primitives in uiDraw. Nothing in the simulation
+ *    knows this class exists.
+ ************************************************************************/
+
+#pragma once
+
+#include "position.h"
+#include <cstddef>
+
+class Skeet;
+class Standard;
+class Floater;
+class Crazy;
+class Sinker;
+class Pellet;
+class Bomb;
+class Shrapnel;
+class Missile;
+class Points;
+class Gun;
+class Effects;
+class Profiler;
+
+/*************************************************************************
+ * RENDERER
+ * Draw one frame of the game
+ *************************************************************************/
+class Renderer
+{
+public:
+   Renderer(const Skeet & skeet, Profiler * profiler = NULL) :
+      skeet(skeet), profiler(profiler), alpha(1.0) {}
+
+   // output everything on the screen
+   void drawLevel(double alpha = 1.0);  // output the game, [alpha] of
+                                        //    the way through the frame
+   void drawStatus();    // output the status information
+   void drawProfile();   // output the profiler's statistics
+
+   // birds
+   void draw(const Standard & bird);
+   void draw(const Floater  & bird);
+   void draw(const Crazy    & bird);
+   void draw(const Sinker   & bird);
+
+   // bullets
+   void draw(const Pellet   & bullet);
+   void draw(const Bomb     & bullet);
+   void draw(const Shrapnel & bullet);
+   void draw(const Missile  & bullet);
+
+private:
+   void draw(const Points & points);
+   void draw(const Gun & gun);
+   void draw(const Effects & effects);
+
+   // where to draw something that moves
+   Position interpolate(const Position & last, const Position & now) const;
+   template <class T>
+   Position where(const T & element) const
+   {
+      return interpolate(element.getLastPosition(), element.getPosition());
+   }
+
+   const Skeet & skeet;
+   Profiler * profiler;  // where the draw groups are timed, if anywhere
+   double alpha;         // how far between the last frame and this one
+};
@@ -0,0 +1,266 @@
+/***********************************************************************
+ * Source File:
+ *    REPLAY : The seed and every frame of input of one game
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    Reading and writing replay files, and playing them back
+ ************************************************************************/
+
+#include <cstring>
+#include <fstream>
+#include "replay.h"
+#include "skeet.h"
+using namespace std;
+
+#define MAGIC   "SKRP"
+#define VERSION 2   // 1 had no press counts: at most one shot a frame
+
+// which keys are down, one bit each
+#define KEY_SPACE 0x01
+#define KEY_M     0x02
+#define KEY_B     0x04
+#define KEY_SHIFT 0x08
+#define KEY_DOWN  0x10
+#define KEY_UP    0x20
+#define KEY_LEFT  0x40
+#define KEY_RIGHT 0x80
+
+/***************************************************************/
+/***************************************************************/
+/*                        READ AND WRITE                       */
+/***************************************************************/
+/***************************************************************/
+
+/*********************************************
+ * WRITE VARINT
+ * Seven bits at a time, low bits first, the high
+ * bit set on every byte but the last
+ *********************************************/
+static void writeVarint(ostream & out, uint64_t value)
+{
+   while (value >= 0x80)
+   {
+      out.put((char)((value & 0x7f) | 0x80));
+      value >>= 7;
+   }
+   out.put((char)value);
+}
+
+/*********************************************
+ * READ VARINT
+ *********************************************/
+static bool readVarint(istream & in, uint64_t & value)
+{
+   value = 0;
+   for (int shift = 0; shift < 64; shift += 7)
+   {
+      int c = in.get();
+      if (c == EOF)
+         return false;
+      value |= (uint64_t)(c & 0x7f) << shift;
+      if (!(c & 0x80))
+         return true;
+   }
+   return false;
+}
+
+/*********************************************
+ * WRITE / READ FIXED
+ * Eight bytes, low byte first, whatever the machine
+ *********************************************/
+static void writeFixed(ostream & out, uint64_t value)
+{
+   for (int i = 0; i < 8; i++)
+      out.put((char)(value >> (i * 8)));
+}
+static bool readFixed(istream & in, uint64_t & value)
+{
+   value = 0;
+   for (int i = 0; i < 8; i++)
+   {
+      int c = in.get();
+      if (c == EOF)
+         return false;
+      value |= (uint64_t)(unsigned char)c << (i * 8);
+   }
+   return true;
+}
+
+// doubles go through the same eight bytes so nothing is lost
+static void writeDouble(ostream & out, double value)
+{
+   uint64_t bits;
+   memcpy(&bits, &value, sizeof(bits));
+   writeFixed(out, bits);
+}
+static bool readDouble(istream & in, double & value)
+{
+   uint64_t bits;
+   if (!readFixed(in, bits))
+      return false;
+   memcpy(&value, &bits, sizeof(value));
+   return true;
+}
+
+/*********************************************
+ * SAME INPUT
+ * Did the player do exactly the same thing both frames?
+ *********************************************/
+static bool sameInput(const Input & lhs, const Input & rhs)
+{
+   return lhs.isDown()  == rhs.isDown()  && lhs.isUp()    == rhs.isUp()    &&
+          lhs.isLeft()  == rhs.isLeft()  && lhs.isRight() == rhs.isRight() &&
+          lhs.isSpace() == rhs.isSpace() && lhs.isM()     == rhs.isM()     &&
+          lhs.isB()     == rhs.isB()     && lhs.isShift() == rhs.isShift();
+}
+
+/*********************************************
+ * REPLAY : SAVE
+ *********************************************/
+bool Replay::save(const string & fileName) const
+{
+   ofstream out(fileName, ios::binary);
+   if (!out)
+      return false;
+
+   // header
+   out.write(MAGIC, 4);
+   out.put((char)VERSION);
+   writeFixed(out, seed);
+   writeDouble(out, dimensions.getX());
+   writeDouble(out, dimensions.getY());
+   writeVarint(out, frames.size());
+
+   // runs of identical frames
+   for (size_t i = 0; i < frames.size(); )
+   {
+      const Input & input = frames[i];
+      size_t run = 1;
+      while (i + run < frames.size() && sameInput(frames[i + run], input))
+         run++;
+      writeVarint(out, run);
+
+      int keys = (input.isSpace() ? KEY_SPACE : 0) |
+                 (input.isM()     ? KEY_M     : 0) |
+                 (input.isB()     ? KEY_B     : 0) |
+                 (input.isShift() ? KEY_SHIFT : 0) |
+                 (input.isDown()  ? KEY_DOWN  : 0) |
+                 (input.isUp()    ? KEY_UP    : 0) |
+                 (input.isLeft()  ? KEY_LEFT  : 0) |
+                 (input.isRight() ? KEY_RIGHT : 0);
+      out.put((char)keys);
+      for (int presses : { input.isSpace(), input.isM(), input.isB() })
+         if (presses)
+            writeVarint(out, (uint64_t)presses);
+      for (int held : { input.isDown(), input.isUp(), input.isLeft(), input.isRight() })
+         if (held)
+            writeVarint(out, (uint64_t)held);
+
+      i += run;
+   }
+
+   return (bool)out;
+}
+
+/*********************************************
+ * REPLAY : LOAD
+ * On failure the replay is left empty
+ *********************************************/
+bool Replay::load(const string & fileName)
+{
+   frames.clear();
+   ifstream in(fileName, ios::binary);
+   if (!in)
+      return false;
+
+   // header
+   char magic[4];
+   uint64_t numFrames;
+   double width;
+   double height;
+   int version;
+   if (!in.read(magic, 4) || memcmp(magic, MAGIC, 4) != 0 ||
+       ((version = in.get()) != 1 && version != VERSION) ||
+       !readFixed(in, seed) || !readDouble(in, width) || !readDouble(in, height) ||
+       !readVarint(in, numFrames))
+      return false;
+   dimensions = Position(width, height);
+
+   // runs of identical frames
+   frames.reserve((size_t)numFrames);
+   while (frames.size() < numFrames)
+   {
+      uint64_t run;
+      int keys;
+      if (!readVarint(in, run) || run == 0 || run > numFrames - frames.size() ||
+          (keys = in.get()) == EOF)
+      {
+         frames.clear();
+         return false;
+      }
+
+      // version 1 fired only the first of space, M, and B, so
+      // the others are dropped to play the same
+      if (version == 1 && (keys & KEY_SPACE))
+         keys &= ~(KEY_M | KEY_B);
+      else if (version == 1 && (keys & KEY_M))
+         keys &= ~KEY_B;
+
+      Input input;
+      input.setShift((keys & KEY_SHIFT) != 0);
+      uint64_t presses[3] = { 0, 0, 0 };
+      int shots[3] = { KEY_SPACE, KEY_M, KEY_B };
+      for (int i = 0; i < 3; i++)
+      {
+         if (!(keys & shots[i]))
+            continue;
+         presses[i] = 1;
+         if (version > 1 && (!readVarint(in, presses[i]) || presses[i] == 0))
+         {
+            frames.clear();
+            return false;
+         }
+      }
+      input.setSpace((int)presses[0]);
+      input.setM((int)presses[1]);
+      input.setB((int)presses[2]);
+      uint64_t held[4] = { 0, 0, 0, 0 };
+      int arrows[4] = { KEY_DOWN, KEY_UP, KEY_LEFT, KEY_RIGHT };
+      for (int i = 0; i < 4; i++)
+         if ((keys & arrows[i]) && !readVarint(in, held[i]))
+         {
+            frames.clear();
+            return false;
+         }
+      input.setDown((int)held[0]);
+      input.setUp((int)held[1]);
+      input.setLeft((int)held[2]);
+      input.setRight((int)held[3]);
+
+      frames.insert(frames.end(), (size_t)run, input);
+   }
+
+   return true;
+}
+
+/***************************************************************/
+/***************************************************************/
+/*                           PLAYBACK                          */
+/***************************************************************/
+/***************************************************************/
+
+/*********************************************
+ * REPLAY : PLAY
+ * Exactly what the game loop does every frame,
+ * without drawing or waiting
+ *********************************************/
+size_t Replay::play(Skeet & skeet) const
+{
+   for (const Input & input : frames)
+   {
+      skeet.interact(input);
+      skeet.animate();
+   }
+   return frames.size();
+}
@@ -0,0 +1,63 @@
+/***********************************************************************
+ * Header File:
+ *    REPLAY : The seed and every frame of input of one game
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    A game is fully decided by its seed, the size of the screen, and
+ *    the Input of every frame. A Replay records those and writes them to
+ *    a small binary file; reading the file back and feeding the frames
+ *    to a fresh Skeet plays the exact same game again, as fast as the
+ *    processor allows.
+ *
+ *    The file is "SKRP", a version byte, the seed, the width and height,
+ *    the number of frames, and then runs of identical frames: how many
+ *    frames in a row, a byte of which keys are down, how many times each
+ *    of space, M, and B was pressed, and how long each held arrow has been
+ *    held. The counts are varints, so a frame where
+ *    nothing changes costs nothing and a typical frame a few bytes.
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "input.h"
+#include "position.h"
+
+class Skeet;
+
+/*********************************************
+ * REPLAY
+ * Everything needed to play a game again
+ *********************************************/
+class Replay
+{
+public:
+   Replay() : seed(0), dimensions(800.0, 800.0) {}
+   Replay(uint64_t seed, const Position & dimensions) :
+      seed(seed), dimensions(dimensions) {}
+
+   // add the input of the next frame
+   void record(const Input & input) { frames.push_back(input); }
+
+   // write to or read from a file. False if it could not be done.
+   bool save(const std::string & fileName) const;
+   bool load(const std::string & fileName);
+
+   // feed every frame to a game made from this replay's seed and
+   // dimensions. Returns the number of frames played.
+   size_t play(Skeet & skeet) const;
+
+   // getters
+   uint64_t getSeed()                  const { return seed;          }
+   const Position & getDimensions()    const { return dimensions;    }
+   size_t size()                       const { return frames.size(); }
+   const Input & operator [] (size_t i) const { return frames[i];    }
+
+private:
+   uint64_t seed;                // what the game's random numbers started from
+   Position dimensions;          // size of the screen
+   std::vector<Input> frames;    // what the player pressed, frame by frame
+};
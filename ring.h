@@ -0,0 +1,72 @@
+/***********************************************************************
+ * Header File:
+ *    RING : A queue from one thread to another without a lock
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    A fixed-size ring buffer for exactly one producer and one consumer.
+ *    The producer only writes the tail and the consumer only writes the
+ *    head, so neither ever waits on the other: a push into a full ring,
+ *    or a look into an empty one, simply fails. The indices count up
+ *    forever and are wrapped when used, so full and empty are never
+ *    confused.
+ ************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+/*********************************************
+ * RING
+ * Up to [N] values, oldest first. [N] is a power of two
+ *********************************************/
+template <class T, size_t N>
+class Ring
+{
+   static_assert(N > 0 && (N & (N - 1)) == 0, "the size of a ring is a power of two");
+
+public:
+   Ring() : head(0), tail(0) {}
+   Ring(const Ring &) = delete;
+   Ring & operator = (const Ring &) = delete;
+
+   // the producer: add to the back. False if the ring is full
+   bool push(const T & value)
+   {
+      size_t back = tail.load(std::memory_order_relaxed);
+      if (back - head.load(std::memory_order_acquire) == N)
+         return false;
+      values[back & (N - 1)] = value;
+      tail.store(back + 1, std::memory_order_release);
+      return true;
+   }
+
+   // the consumer: the oldest value, or NULL if there is none. It stays
+   // put until pop()
+   const T * front() const
+   {
+      size_t front = head.load(std::memory_order_relaxed);
+      if (front == tail.load(std::memory_order_acquire))
+         return NULL;
+      return &values[front & (N - 1)];
+   }
+
+   // the consumer: throw away the oldest value. There has to be one
+   void pop()
+   {
+      head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+   }
+
+   // either side, though the answer may be stale by the time it is used
+   size_t size() const
+   {
+      return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+   }
+   bool empty() const { return size() == 0; }
+
+private:
+   T values[N];
+   alignas(64) std::atomic<size_t> head;   // next to be taken
+   alignas(64) std::atomic<size_t> tail;   // next to be filled
+};
@@ -34,6 +34,7 @@ public:
     std::string getText() const;
     void adjust(int value) { points += value; }
     void reset() { points = 0; }
+    int getPoints() const { return points; }
 private:
     int points;
 };
@@ -49,6 +50,8 @@ public:
     std::string getText() const;
     void adjust(int value);
     void reset() { numKilled = numMissed = 0; }
+    int getKilled() const { return numKilled; }
+    int getMissed() const { return numMissed; }
 private:
     int numKilled;
     int numMissed;
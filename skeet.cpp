@@ -3,33 +3,15 @@
  * No actual birds were killed in the making of this game.
  **********************************************************************/
 
-#include <string>
-#include <sstream>
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <type_traits>
 #include "skeet.h"
 using namespace std;
 
-
-#ifdef __APPLE__
-#define GL_SILENCE_DEPRECATION
-#include <openGL/gl.h>    // Main OpenGL library
-#include <GLUT/glut.h>    // Second OpenGL library
-#define GLUT_TEXT GLUT_BITMAP_HELVETICA_18
-#endif // __APPLE__
-
-#ifdef __linux__
-#include <GL/gl.h>        // Main OpenGL library
-#include <GL/glut.h>      // Second OpenGL library
-#define GLUT_TEXT GLUT_BITMAP_HELVETICA_12
-#endif // __linux__
-
-#ifdef _WIN32
-#include <stdio.h>
-#include <stdlib.h>
-#include <GL/glut.h>         // OpenGL library we copied 
-#define _USE_MATH_DEFINES
-#include <math.h>
-#define GLUT_TEXT GLUT_BITMAP_HELVETICA_12
-#endif // _WIN32
+// above this many bird and bullet pairs, go through the grid
+#define BLOCK_PAIRS 2048
 
 /************************
  * SKEET ANIMATE
@@ -51,304 +33,288 @@ void Skeet::animate()
    }
    
    // spawn
-   spawn();
+   {
+      ProfileScope scope(profiler, STAGE_SPAWN);
+      spawn();
+   }
    
-   // move the birds and the bullets
-   for (auto element : birds)
+   // move the birds and the bullets. Each is called as its own kind
+   // so the calls are not virtual
+   {
+      ProfileScope scope(profiler, STAGE_ADVANCE);
+      advanceBirds();
+   }
+   {
+      ProfileScope scope(profiler, STAGE_MOVE);
+      moveBullets();
+   }
    {
-      element->advance();
-      hitRatio.adjust(element->isDead() ? -1 : 0);
+      ProfileScope scope(profiler, STAGE_EFFECTS);
+      effects.fly(jobs, grain);
+      for (auto & pts : points)
+         pts.update(random);
    }
-   for (auto bullet : bullets)
-      bullet->move(effects);
-   for (auto effect : effects)
-      effect->fly();
-   for (auto & pts : points)
-      pts.update();
       
-   // hit detection
-   for (auto element : birds)
-      for (auto bullet : bullets)
-         if (!element->isDead() && !bullet->isDead() &&
-             element->getRadius() + bullet->getRadius() >
-             minimumDistance(element->getPosition(), element->getVelocity(),
-                             bullet->getPosition(),  bullet->getVelocity()))
-         {
-            for (int i = 0; i < 25; i++)
-               effects.push_back(new Fragment(bullet->getPosition(), bullet->getVelocity()));
-            element->kill();
-            bullet->kill();
-            hitRatio.adjust(1);
-            bullet->setValue(-(element->getPoints()));
-            element->setPoints(0);
-         }
+   // hit detection. A handful of birds is fastest tested all at once
+   // with SIMD; a crowd is fastest narrowed down with the grid first.
+   // Both find the same pairs, and they are always resolved bird by bird
+   // and then bullet by bullet, so the same bullet wins every time
+   {
+      ProfileScope scope(profiler, STAGE_HITS);
+      if (birds.size() * bullets.size() <= BLOCK_PAIRS)
+         findHitsBlock();
+      else
+         findHitsGrid();
+   }
    
    // remove the zombie birds
-   for (auto it = birds.begin(); it != birds.end();)
-      if ((*it)->isDead())
-      {
-         if ((*it)->getPoints())
-            points.push_back(Points((*it)->getPosition(), (*it)->getPoints()));
-         score.adjust((*it)->getPoints());
-         it = birds.erase(it);
-      }
-      else
-         ++it;
+   {
+      ProfileScope scope(profiler, STAGE_REMOVE_BIRDS);
+      for (auto & element : birds)
+         if (element.isDead())
+         {
+            if (element.getPoints())
+               points.add(dimensions, element.getPosition(), element.getPoints(), random);
+            score.adjust(element.getPoints());
+         }
+      birds.removeIf([](const Bird & element) { return element.isDead(); });
+   }
        
-   // remove zombie bullets
-   for (auto it = bullets.begin(); it != bullets.end(); )
-      if ((*it)->isDead())
-      {
-         (*it)->death(bullets);
-         int value = -(*it)->getValue();
-         points.push_back(Points((*it)->getPosition(), value));
-         score.adjust(value);
-         it = bullets.erase(it);
-      }
-      else
-         ++it;
-   
-   // remove zombie fragments
-   for (auto it = effects.begin(); it != effects.end();)
-      if ((*it)->isDead())
-         it = effects.erase(it);
-      else
-         ++it;
+   // remove zombie bullets. Death can add more bullets to the end
+   // of the pool (and move the pool), so go by index
+   {
+      ProfileScope scope(profiler, STAGE_REMOVE_BULLETS);
+      for (size_t i = 0; i < bullets.size(); i++)
+         if (bullets[i].isDead())
+         {
+            bullets[i].death(bullets, random);
+            int value = -bullets[i].getValue();
+            points.add(dimensions, bullets[i].getPosition(), value, random);
+            score.adjust(value);
+         }
+      bullets.removeIf([](const Bullet & bullet) { return bullet.isDead(); });
+   }
 
    // remove expired points
-   for (auto it = points.begin(); it != points.end();)
-      if ((*it).isDead())
-         it = points.erase(it);
-      else
-         ++it;
+   ProfileScope scope(profiler, STAGE_REMOVE_POINTS);
+   points.removeIf([](const Points & pts) { return pts.isDead(); });
 }
 
-/************************************************************************
- * DRAW Background
- * Fill in the background
- *  INPUT color   Background color
- *************************************************************************/
-void Skeet::drawBackground(double redBack, double greenBack, double blueBack) const
+/************************
+ * SKEET FILL
+ * Top up the birds, missiles, bombs, and fragments.
+ * The birds take turns being each kind, the bullets
+ * leave the gun at any angle, and the fragments are
+ * scattered across the screen
+ ************************/
+void Skeet::fill(size_t numBirds, size_t numMissiles, size_t numBombs, size_t numFragments)
 {
-   glBegin(GL_TRIANGLE_FAN);
-
-   // two rectangles is the fastest way to fill the screen.
-   glColor3f((GLfloat)redBack /* red % */, (GLfloat)greenBack /* green % */, (GLfloat)blueBack /* blue % */);
-   glVertex2f((GLfloat)0.0, (GLfloat)0.0);
-   glVertex2f((GLfloat)dimensions.getX(), (GLfloat)0.0);
-   glVertex2f((GLfloat)dimensions.getX(), (GLfloat)dimensions.getY());
-   glVertex2f((GLfloat)0.0, (GLfloat)dimensions.getY());
+   for (size_t i = birds.size(); i < numBirds; i++)
+      switch (i % 4)
+      {
+         case 0:
+            birds.add<Standard>(dimensions, random, 15.0);
+            break;
+         case 1:
+            birds.add<Floater>(dimensions, random, 15.0);
+            break;
+         case 2:
+            birds.add<Crazy>(dimensions, random, 15.0);
+            break;
+         case 3:
+            birds.add<Sinker>(dimensions, random, 15.0);
+            break;
+      }
 
-   glEnd();
+   size_t missiles = 0;
+   size_t bombs = 0;
+   bullets.forEach([&missiles, &bombs](const auto & bullet)
+   {
+      typedef std::decay_t<decltype(bullet)> Kind;
+      missiles += std::is_same_v<Kind, Missile>;
+      bombs += std::is_same_v<Kind, Bomb>;
+   });
+   for (; missiles < numMissiles; missiles++)
+      bullets.add<Missile>(dimensions, random.nextDouble(0.05, 1.52));
+   for (; bombs < numBombs; bombs++)
+      bullets.add<Bomb>(dimensions, random.nextDouble(0.05, 1.52));
+
+   for (size_t i = effects.getFragments().size(); i < numFragments; i++)
+      effects.addFragment(Position(random.nextDouble(0.0, dimensions.getX()),
+                                   random.nextDouble(0.0, dimensions.getY())),
+                          Velocity(random.nextDouble(-10.0, 10.0), random.nextDouble(-10.0, 10.0)),
+                          random);
 }
 
-/************************************************************************
- * DRAW Timer
- * Draw a large timer on the screen
- *  INPUT percent     Amount of time left
- *        Foreground  Foreground color
- *        Background  Background color
- *************************************************************************/
-void Skeet::drawTimer(double percent,
-                     double redFore, double greenFore, double blueFore,
-                     double redBack, double greenBack, double blueBack) const
+/************************
+ * SKEET ADVANCE BIRDS
+ * Birds do not touch each other, so they can all fly at
+ * once, except that the ones that draw random numbers
+ * have to draw them in order. They go afterwards, one at
+ * a time, which is the same as if everyone had gone in
+ * order. Then count the ones that flew off the screen.
+ ************************/
+void Skeet::advanceBirds()
 {
-   double radians;
-
-   GLfloat length = (GLfloat)dimensions.getX();
-   GLfloat half = length / (GLfloat)2.0;
-
-   // do the background stuff
-   drawBackground(redBack, greenBack, blueBack);
-
-   // foreground stuff
-   radians = percent * M_PI * 2.0;
-   GLfloat x_extent = half + length * (GLfloat)sin(radians);
-   GLfloat y_extent = half + length * (GLfloat)cos(radians);
-
-   // get read to draw the triangles
-   glBegin(GL_TRIANGLE_FAN);
-   glColor3f((GLfloat)redFore /* red % */, (GLfloat)greenFore /* green % */, (GLfloat)blueFore /* blue % */);
-   glVertex2f(half, half);
-
-   // fill in the triangles, one eight at a time
-   switch ((int)(percent * 8.0))
+   if (!jobs || birds.size() <= grain)
    {
-   case 7: // 315 - 360
-      glVertex2f(half, length);
-      glVertex2f(length, length);
-      glVertex2f(length, 0.0);
-      glVertex2f(0.0, 0.0);
-      glVertex2f(0.0, length);
-      break;
-   case 6: // 270 - 315
-      glVertex2f(half, length);
-      glVertex2f(length, length);
-      glVertex2f(length, 0.0);
-      glVertex2f(0.0, 0.0);
-      glVertex2f(0.0, half);
-      break;
-   case 5: // 225 - 270
-      glVertex2f(half, length);
-      glVertex2f(length, length);
-      glVertex2f(length, 0.0);
-      glVertex2f(0.0, 0.0);
-      break;
-   case 4: // 180 - 225
-      glVertex2f(half, length);
-      glVertex2f(length, length);
-      glVertex2f(length, 0.0);
-      glVertex2f(half, 0.0);
-      break;
-   case 3: // 135 - 180
-      glVertex2f(half, length);
-      glVertex2f(length, length);
-      glVertex2f(length, half);
-      glVertex2f(length, 0.0);
-      break;
-   case 2: // 90 - 135 degrees
-      glVertex2f(half, length);
-      glVertex2f(length, length);
-      glVertex2f(length, half);
-      break;
-   case 1: // 45 - 90 degrees
-      glVertex2f(half, length);
-      glVertex2f(length, length);
-      break;
-   case 0: // 0 - 45 degrees
-      glVertex2f(half, length);
-      break;
+      birds.forEach([this](auto & element)
+      {
+         element.advance(dimensions, random);
+         hitRatio.adjust(element.isDead() ? -1 : 0);
+      });
+      return;
    }
-   glVertex2f(x_extent, y_extent);
-
-   // complete drawing
-   glEnd();
 
-   // draw the red line now
-   glBegin(GL_LINES);
-   glColor3f((GLfloat)0.6, (GLfloat)0.0, (GLfloat)0.0);
-   glVertex2f(half, half);
-   glVertex2f(x_extent, y_extent);
-   glColor3f((GLfloat)1.0 /* red % */, (GLfloat)1.0 /* green % */, (GLfloat)1.0 /* blue % */);
-   glEnd();
+   jobs->parallelFor(birds.size(), grain, [this](size_t chunk, size_t begin, size_t end)
+   {
+      birds.forEach(begin, end, [this](auto & element)
+      {
+         if constexpr (!std::decay_t<decltype(element)>::drawsRandom)
+            element.advance(dimensions, random);
+      });
+   });
+   birds.forEach([this](auto & element)
+   {
+      if constexpr (std::decay_t<decltype(element)>::drawsRandom)
+         element.advance(dimensions, random);
+      hitRatio.adjust(element.isDead() ? -1 : 0);
+   });
 }
 
-/*************************************************************************
- * DRAW TEXT
- * Draw text using a simple bitmap font
- *   INPUT  topLeft   The top left corner of the text
- *          text      The text to be displayed
- ************************************************************************/
-void drawText(const Position& topLeft, const char* text) 
+/************************
+ * SKEET MOVE BULLETS
+ * Every chunk of bullets leaves its trails in its own
+ * effects. Adding those to the game's in chunk order puts
+ * the trails in the same order as moving one at a time.
+ ************************/
+void Skeet::moveBullets()
 {
-   void* pFont = GLUT_TEXT;
-   glColor3f((GLfloat)1.0 /* red % */, (GLfloat)1.0 /* green % */, (GLfloat)1.0 /* blue % */);
-
-   // prepare to output the text from the top-left corner
-   glRasterPos2f((GLfloat)topLeft.getX(), (GLfloat)topLeft.getY());
+   if (!jobs || bullets.size() <= grain)
+   {
+      bullets.forEach([this](auto & bullet) { bullet.move(dimensions, effects); });
+      return;
+   }
 
-   // loop through the text
-   for (const char* p = text; *p; p++)
-      glutBitmapCharacter(pFont, *p);
+   size_t numChunks = (bullets.size() + grain - 1) / grain;
+   if (chunkEffects.size() < numChunks)
+      chunkEffects.resize(numChunks);
+   jobs->parallelFor(bullets.size(), grain, [this](size_t chunk, size_t begin, size_t end)
+   {
+      Effects & trails = chunkEffects[chunk];
+      trails.clear();
+      bullets.forEach(begin, end, [this, &trails](auto & bullet) { bullet.move(dimensions, trails); });
+   });
+   for (size_t chunk = 0; chunk < numChunks; chunk++)
+      effects.append(chunkEffects[chunk]);
 }
-void drawText(const Position & topLeft, const string & text)
+
+/************************
+ * SKEET FIND HITS GRID
+ * put the bullets in the grid and ask it which
+ * ones are near each bird
+ ************************/
+void Skeet::findHitsGrid()
 {
-   drawText(topLeft, text.c_str());
+   grid.clear();
+   for (size_t i = 0; i < bullets.size(); i++)
+      if (!bullets[i].isDead())
+         grid.insert((int)i, bullets[i].getPosition(), bullets[i].getVelocity(),
+                     bullets[i].getRadius());
+   for (auto & element : birds)
+   {
+      if (element.isDead())
+         continue;
+      grid.query(element.getPosition(), element.getVelocity(), element.getRadius(), nearby);
+      for (int index : nearby)
+         collide(element, bullets[index]);
+   }
 }
 
 /************************
- * DRAW BULLSEYE
- * Put a bullseye on the screen
+ * SKEET FIND HITS BLOCK
+ * pack the live birds into the block, test every
+ * bullet against all of them, then sort the pairs
+ * into bird-major order
  ************************/
-void Skeet::drawBullseye(double angle) const
+void Skeet::findHitsBlock()
 {
-   // find where we are pointing
-   double distance = dimensions.getX();
-   GLfloat x = dimensions.getX() - distance * cos(angle);
-   GLfloat y = distance * sin(angle);
-
-   // draw the crosshairs
-   glBegin(GL_LINES);
-   glColor3f((GLfloat)0.6, (GLfloat)0.6, (GLfloat)0.6);
-
-   // Draw the actual lines
-   glVertex2f(x - 10.0, y);
-   glVertex2f(x + 10.0, y);
-
-   glVertex2f(x, y - 10.0);
-   glVertex2f(x, y + 10.0);
+   block.clear();
+   blockBirds.clear();
+   for (size_t i = 0; i < birds.size(); i++)
+      if (!birds[i].isDead())
+      {
+         block.add(birds[i].getPosition(), birds[i].getVelocity(), birds[i].getRadius());
+         blockBirds.push_back((int)i);
+      }
+   if (block.size() == 0)
+      return;
 
-   glColor3f((GLfloat)0.2, (GLfloat)0.2, (GLfloat)0.2);
-   glVertex2f(dimensions.getX(), 0.0);
-   glVertex2f(x, y);
+   // the bullets go in order, so a stable sort on the bird is enough
+   contacts.clear();
+   for (size_t i = 0; i < bullets.size(); i++)
+   {
+      if (bullets[i].isDead())
+         continue;
+      touching.clear();
+      block.collide(bullets[i].getPosition(), bullets[i].getVelocity(),
+                    bullets[i].getRadius(), touching);
+      for (int slot : touching)
+         contacts.push_back(make_pair(blockBirds[slot], (int)i));
+   }
+   stable_sort(contacts.begin(), contacts.end(),
+               [](const pair<int, int> & lhs, const pair<int, int> & rhs)
+               { return lhs.first < rhs.first; });
 
-   // Complete drawing
-   glEnd();
+   for (auto & contact : contacts)
+      collide(birds[contact.first], bullets[contact.second]);
 }
 
 /************************
- * SKEET DRAW LEVEL
- * output everything that will be on the screen
+ * SKEET COLLIDE
+ * if the bird and the bullet are both still alive and
+ * touch this frame, kill them both
  ************************/
-void Skeet::drawLevel() const
+void Skeet::collide(Bird & element, Bullet & bullet)
 {
-   // output the background
-   drawBackground(time.level() * .1, 0.0, 0.0);
-   
-   // draw the bullseye
-   if (bullseye)
-      drawBullseye(gun.getAngle());
-
-   // output the gun
-   gun.display();
-         
-   // output the birds, bullets, and fragments
-   for (auto& pts : points)
-      pts.show();
-   for (auto effect : effects)
-      effect->render();
-   for (auto bullet : bullets)
-      bullet->output();
-   for (auto element : birds)
-      element->draw();
-   
-   // status
-   drawText(Position(10,                         dimensions.getY() - 30), score.getText()  );
-   drawText(Position(dimensions.getX() / 2 - 30, dimensions.getY() - 30), time.getText()   );
-   drawText(Position(dimensions.getX() - 110,    dimensions.getY() - 30), hitRatio.getText());
+   double time;
+   if (!element.isDead() && !bullet.isDead() &&
+       timeOfImpact(element.getPosition(), element.getVelocity(),
+                    bullet.getPosition(),  bullet.getVelocity(),
+                    element.getRadius() + bullet.getRadius(), time))
+   {
+      // the fragments fly from where the bullet struck the bird
+      Position ptImpact(bullet.getPosition());
+      ptImpact.add(bullet.getVelocity() * time);
+      for (int i = 0; i < 25; i++)
+         effects.addFragment(ptImpact, bullet.getVelocity(), random);
+      element.kill();
+      bullet.kill();
+      hitRatio.adjust(1);
+      bullet.setValue(-(element.getPoints()));
+      element.setPoints(0);
+   }
 }
 
 /************************
- * SKEET DRAW STATUS
- * place the status message on the center of the screen
+ * SKEET GET LIVE OBJECTS
+ * how many things are in the game right now
  ************************/
-void Skeet::drawStatus() const
+size_t Skeet::getLiveObjects() const
 {
-   // output the text information
-   ostringstream sout;
-   if (time.isGameOver())
-   {
-      // draw the end of game message
-      drawText(Position(dimensions.getX() / 2 - 30, dimensions.getY() / 2 + 10),
-               "Game Over");
-
-      // draw end of game status
-      drawText(Position(dimensions.getX() / 2 - 30, dimensions.getY() / 2 - 10),
-               score.getText());
-   }
-   else
-   {
-      // output the status timer
-      drawTimer(1.0 - time.percentLeft(),
-                     (time.level() - 0.0) * .1, 0.0, 0.0,
-                     (time.level() - 1.0) * .1, 0.0, 0.0);
+   return birds.size() + bullets.size() + effects.size() + points.size();
+}
 
-      // draw the message giving a countdown
-      sout << "Level " << time.level()
-           << " begins in " << time.secondsLeft() << " seconds";
-      drawText(Position(dimensions.getX() / 2 - 110, dimensions.getY() / 2 - 10),
-         sout.str());
-   }
+/************************
+ * SKEET GET BYTES ALLOCATED
+ * how much memory is set aside for the things in the game
+ ************************/
+size_t Skeet::getBytesAllocated() const
+{
+   size_t bytes = birds.bytes() + bullets.bytes() + effects.bytes() + points.bytes();
+   for (const Effects & trails : chunkEffects)
+      bytes += trails.bytes();
+   return bytes;
 }
 
 /************************
@@ -384,7 +350,7 @@ void Skeet::drawStatus() const
  * SKEET INTERACT
  * handle all user input
  ************************/
-void Skeet::interact(const UserInput & ui)
+void Skeet::interact(const Input & ui)
 {
    // reset the game
    if (time.isGameOver() && ui.isSpace())
@@ -397,121 +363,58 @@ void Skeet::interact(const UserInput & ui)
 
    // gather input from the interface
    gun.interact(ui.isUp() + ui.isRight(), ui.isDown() + ui.isLeft());
-   Bullet *p = nullptr;
 
-   // a pellet can be shot at any time
-   if (ui.isSpace())
-      p = new Pellet(gun.getAngle());
+   // every press is a shot. A pellet can be shot at any time
+   for (int i = 0; i < ui.isSpace(); i++)
+      bullets.add<Pellet>(dimensions, gun.getAngle());
    // missiles can be shot at level 2 and higher
-   else if (ui.isM() && time.level() > 1)
-      p = new Missile(gun.getAngle());
+   if (time.level() > 1)
+      for (int i = 0; i < ui.isM(); i++)
+         bullets.add<Missile>(dimensions, gun.getAngle());
    // bombs can be shot at level 3 and higher
-   else if (ui.isB() && time.level() > 2)
-      p = new Bomb(gun.getAngle());
+   if (time.level() > 2)
+      for (int i = 0; i < ui.isB(); i++)
+         bullets.add<Bomb>(dimensions, gun.getAngle());
    
    bullseye = ui.isShift();
-
-   // add something if something has been added
-   if (nullptr != p)
-      bullets.push_back(p);
    
    // send movement information to all the bullets. Only the missile cares.
-   for (auto bullet : bullets)
-      bullet->input(ui.isUp() + ui.isRight(), ui.isDown() + ui.isLeft(), ui.isB());
-}
-
-/******************************************************************
- * RANDOM
- * This function generates a random number.
- *
- *    INPUT:   min, max : The number of values (min <= num <= max)
- *    OUTPUT   <return> : Return the integer
- ****************************************************************/
-int random(int min, int max)
-{
-   assert(min < max);
-   int num = (rand() % (max - min)) + min;
-   assert(min <= num && num <= max);
-
-   return num;
+   bullets.forEach([&ui](auto & bullet)
+   {
+      bullet.input(ui.isUp() + ui.isRight(), ui.isDown() + ui.isLeft(), ui.isB() > 0);
+   });
 }
 
 /************************
  * SKEET SPAWN
- * lanuch new birds
+ * lanuch new birds: each kind in the level
+ * takes its chance in turn
  ************************/
 void Skeet::spawn()
 {
-   double size;
-   switch (time.level())
+   for (const Spawner & spawner : (*levels)[time.level()].spawners)
    {
-      // in level 1 spawn big birds occasionally
-      case 1:
-         size = 30.0;
-         // spawns when there is nothing on the screen
-         if (birds.size() == 0 && random(0, 15) == 1)
-            birds.push_back(new Standard(size, 7.0));
-         
-         // spawn every 4 seconds
-         if (random(0, 4 * 30) == 1)
-            birds.push_back(new Standard(size, 7.0));
-         break;
-         
-      // two kinds of birds in level 2
-      case 2:
-         size = 25.0;
-         // spawns when there is nothing on the screen
-         if (birds.size() == 0 && random(0, 15) == 1)
-            birds.push_back(new Standard(size, 7.0, 12));
-
-         // spawn every 4 seconds
-         if (random(0, 4 * 30) == 1)
-            birds.push_back(new Standard(size, 5.0, 12));
-         // spawn every 3 seconds
-         if (random(0, 3 * 30) == 1)
-            birds.push_back(new Sinker(size));
-         break;
-      
-      // three kinds of birds in level 3
-      case 3:
-         size = 20.0;
-         // spawns when there is nothing on the screen
-         if (birds.size() == 0 && random(0, 15) == 1)
-            birds.push_back(new Standard(size, 5.0, 15));
-
-         // spawn every 4 seconds
-         if (random(0, 4 * 30) == 1)
-            birds.push_back(new Standard(size, 5.0, 15));
-         // spawn every 4 seconds
-         if (random(0, 4 * 30) == 1)
-            birds.push_back(new Sinker(size, 4.0, 22));
-         // spawn every 4 seconds
-         if (random(0, 4 * 30) == 1)
-            birds.push_back(new Floater(size));
-         break;
-         
-      // three kinds of birds in level 4
-      case 4:
-         size = 15.0;
-         // spawns when there is nothing on the screen
-         if (birds.size() == 0 && random(0, 15) == 1)
-            birds.push_back(new Standard(size, 4.0, 18));
-
-         // spawn every 4 seconds
-         if (random(0, 4 * 30) == 1)
-            birds.push_back(new Standard(size, 4.0, 18));
-         // spawn every 4 seconds
-         if (random(0, 4 * 30) == 1)
-            birds.push_back(new Sinker(size, 3.5, 25));
-         // spawn every 4 seconds
-         if (random(0, 4 * 30) == 1)
-            birds.push_back(new Floater(size, 4.0, 25));
-         // spawn every 4 seconds
-         if (random(0, 4 * 30) == 1)
-            birds.push_back(new Crazy(size));
-         break;
-         
-      default:
-         break;
+      // some only come when there is nothing on the screen
+      if (spawner.whenEmpty && birds.size() != 0)
+         continue;
+      if (spawner.odds > 1 && random.nextInt(0, spawner.odds) != 1)
+         continue;
+
+      for (int i = 0; i < spawner.count; i++)
+         switch (spawner.kind)
+         {
+            case Spawner::STANDARD:
+               birds.add<Standard>(dimensions, random, spawner.radius, spawner.speed, spawner.points);
+               break;
+            case Spawner::FLOATER:
+               birds.add<Floater>(dimensions, random, spawner.radius, spawner.speed, spawner.points);
+               break;
+            case Spawner::CRAZY:
+               birds.add<Crazy>(dimensions, random, spawner.radius, spawner.speed, spawner.points);
+               break;
+            case Spawner::SINKER:
+               birds.add<Sinker>(dimensions, random, spawner.radius, spawner.speed, spawner.points);
+               break;
+         }
    }
 }
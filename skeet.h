@@ -10,16 +10,25 @@
 #pragma once
 
 #include "position.h"
-#include "uiInteract.h"
+#include "input.h"
 #include "bird.h"
 #include "bullet.h"
 #include "effect.h"
 #include "gun.h"
 #include "time.h"
+#include "level.h"
 #include "score.h"
 #include "points.h"
+#include "pool.h"
+#include "grid.h"
+#include "collision.h"
+#include "random.h"
+#include "profiler.h"
+#include "jobs.h"
 
-#include <list>
+#include <cstdint>
+#include <utility>
+#include <vector>
 
 /*************************************************************************
  * Skeet
@@ -28,37 +37,109 @@
 class Skeet
 {
 public:
-    Skeet(Position & dimensions) : dimensions(dimensions), time(), score(), hitRatio(), bullseye(false), gun(Position(800.0, 0.0)){}
+    // the same seed, levels, and input always play the same game. NULL
+    // levels, the default, are the standard ones. They are only read, so
+    // games on different threads can share them
+    Skeet(const Position & dimensions, uint64_t seed, const Levels * levels = NULL) :
+       random(seed),
+       seed(seed),
+       gun(Position(dimensions.getX(), 0.0)),
+       birds(64),
+       bullets(256),
+       effects(4096),
+       points(64),
+       grid(dimensions),
+       levels(levels ? levels : &Levels::standard()),
+       time(this->levels->getSeconds()),   // the levels are set just above
+       score(),
+       hitRatio(),
+       dimensions(dimensions),
+       bullseye(false),
+       profiler(NULL),
+       jobs(NULL),
+       grain(0)
+    {
+    }
 
     // handle all user input
-    void interact(const UserInput& ui);
+    void interact(const Input & input);
 
     // move the gameplay by one unit of time
     void animate();
 
-    // output everything on the screen
-    void drawLevel()  const;    // output the game
-    void drawStatus() const;    // output the status information
-
     // is the game currently playing right now?
     bool isPlaying() const { return time.isPlaying();  }
+
+    // getters so the renderer can see the state of the game
+    const Position & getDimensions()        const { return dimensions; }
+    const Gun & getGun()                    const { return gun;        }
+    const BirdPool & getBirds()             const { return birds;      }
+    const BulletPool & getBullets()         const { return bullets;    }
+    const Effects & getEffects()            const { return effects;    }
+    const Pool<Points> & getPoints()        const { return points;     }
+    const Time & getTime()                  const { return time;       }
+    const Score & getScore()                const { return score;      }
+    const HitRatio & getHitRatio()          const { return hitRatio;   }
+    bool isBullseye()                       const { return bullseye;   }
+    uint64_t getSeed()                      const { return seed;       }
+    const Levels & getLevels()              const { return *levels;    }
+
+    // time each stage of animate(). NULL, the default, times nothing
+    void setProfiler(Profiler * profiler) { this->profiler = profiler; }
+
+    // move the birds, bullets, and fragments on [jobs] in chunks of
+    // [grain] when there are more than that. The game plays out exactly
+    // the same as with NULL, the default, which does it all right here
+    void setJobs(JobSystem * jobs, size_t grain = 256)
+    {
+       this->jobs = jobs;
+       this->grain = grain;
+    }
+
+    // for stress testing: add birds, missiles, bombs, and fragments
+    // until there are at least this many of each
+    void fill(size_t birds, size_t missiles, size_t bombs, size_t fragments);
+
+    // how much memory the game is holding on to. Both stay flat once
+    // the pools have grown to fit the busiest frame.
+    size_t getLiveObjects()   const;   // birds, bullets, effects, and points
+    size_t getBytesAllocated() const;  // bytes set aside for all of them
+
 private:
     // generate new birds
     void spawn();                  
-    void drawBackground(double redBack, double greenBack, double blueBack) const;
-    void drawTimer(double percent,
-                   double redFore, double greenFore, double blueFore,
-                   double redBack, double greenBack, double blueBack) const;
-    void drawBullseye(double angle) const;
 
+    // hit detection: find the bird and bullet pairs that touch this
+    // frame, then let each pair collide in bird-major order
+    void findHitsGrid();
+    void findHitsBlock();
+    void collide(Bird & element, Bullet & bullet);
+
+    // the parts of animate() that can be shared out to the jobs
+    void advanceBirds();
+    void moveBullets();
+
+    Random random;                 // every random number in the game
+    uint64_t seed;                 // where the random numbers started
     Gun gun;                       // the gun
-    std::list<Bird*> birds;        // all the shootable birds
-    std::list<Bullet*> bullets;    // the bullets
-    std::list<Effect*> effects;    // the fragments of a dead bird.
-    std::list<Points>  points;     // point values;
+    BirdPool birds;                // all the shootable birds
+    BulletPool bullets;            // the bullets
+    Effects effects;               // the fragments of a dead bird.
+    Pool<Points> points;           // point values;
+    Grid grid;                     // where the bullets are, for hit detection
+    std::vector<int> nearby;       // the bullets that might hit a given bird
+    BirdBlock block;               // the live birds, packed for the SIMD test
+    std::vector<int> blockBirds;   // which bird is in each slot of the block
+    std::vector<int> touching;     // the birds a given bullet touches
+    std::vector<std::pair<int, int>> contacts; // bird and bullet that touch
+    const Levels * levels;         // what birds come out in each level
     Time time;                     // how many frames have transpired since the beginning
     Score score;                   // the player's score
     HitRatio hitRatio;             // the hit ratio for the birds
     Position dimensions;           // size of the screen
     bool bullseye;
+    Profiler * profiler;           // where the stages are timed, if anywhere
+    JobSystem * jobs;              // who else can help animate, if anyone
+    size_t grain;                  // how many to give each of them at a time
+    std::vector<Effects> chunkEffects; // the trails each chunk of bullets left
 };
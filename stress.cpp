@@ -0,0 +1,179 @@
+/***********************************************************************
+ * Source File:
+ *    STRESS : How many of everything can a frame take?
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    Ramping up the load, and reporting the curve
+ ************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+#include <iomanip>
+#include <sstream>
+#include "stress.h"
+using namespace std;
+
+/*********************************************
+ * MEAN and P99
+ * Of the frames of one step
+ *********************************************/
+static double mean(const vector<double> & values)
+{
+   double sum = 0.0;
+   for (double value : values)
+      sum += value;
+   return values.empty() ? 0.0 : sum / values.size();
+}
+static double p99(vector<double> values)
+{
+   if (values.empty())
+      return 0.0;
+   size_t rank = (values.size() * 99 + 99) / 100 - 1;
+   nth_element(values.begin(), values.begin() + rank, values.end());
+   return values[rank];
+}
+
+/*********************************************
+ * STRESS constructor
+ * The first step is one of each
+ *********************************************/
+Stress::Stress(int kinds, int frames, size_t most) :
+   kinds(kinds), frames(frames), most(most), done(false)
+{
+   assert((kinds & ALL) != 0);
+   assert(frames > 0);
+   steps.push_back(Step { 1, 0 });
+}
+
+/*********************************************
+ * STRESS : PARSE KINDS
+ *********************************************/
+int Stress::parseKinds(const string & text)
+{
+   if (text == "all")
+      return ALL;
+
+   int kinds = 0;
+   stringstream names(text);
+   for (string name; getline(names, name, ','); )
+      if (name == "birds")
+         kinds |= BIRDS;
+      else if (name == "missiles")
+         kinds |= MISSILES;
+      else if (name == "bombs")
+         kinds |= BOMBS;
+      else if (name == "fragments")
+         kinds |= FRAGMENTS;
+      else
+         return 0;
+   return kinds;
+}
+
+/*********************************************
+ * STRESS : GET LEVELS
+ * A day long, and no birds but the ones we add
+ *********************************************/
+const Levels & Stress::getLevels()
+{
+   static const Levels levels = []()
+   {
+      Levels levels;
+      istringstream in("level 86400\n");
+      bool ok = levels.read(in);
+      assert(ok);
+      (void)ok;
+      return levels;
+   }();
+   return levels;
+}
+
+/*********************************************
+ * STRESS : FILL
+ * Nothing during the status screen: it would only
+ * be cleared away again
+ *********************************************/
+void Stress::fill(Skeet & skeet) const
+{
+   if (done || !skeet.isPlaying())
+      return;
+   size_t scale = steps.back().scale;
+   skeet.fill(kinds & BIRDS     ? scale : 0,
+              kinds & MISSILES  ? scale : 0,
+              kinds & BOMBS     ? scale : 0,
+              kinds & FRAGMENTS ? scale : 0);
+}
+
+/*********************************************
+ * STRESS : RECORD
+ * Keep the frame, and double the load once this
+ * step has enough of them
+ *********************************************/
+void Stress::record(const Skeet & skeet, double simulate, double render)
+{
+   if (done || !skeet.isPlaying())
+      return;
+
+   Step & step = steps.back();
+   step.simulate.push_back(simulate);
+   if (render >= 0.0)
+      step.render.push_back(render);
+   step.liveMost = max(step.liveMost, skeet.getLiveObjects());
+   if ((int)step.simulate.size() < frames)
+      return;
+
+   // stop at the most we will try, or once we are well over the cliff
+   size_t scale = step.scale;
+   if (scale * 2 > most || mean(step.simulate) + mean(step.render) > 4.0 * STRESS_BUDGET)
+      done = true;
+   else
+      steps.push_back(Step { scale * 2, 0 });
+}
+
+/*********************************************
+ * STRESS : REPORT
+ * One line for every step, marking those where the
+ * slowest frames went over the budget
+ *********************************************/
+void Stress::report(ostream & out) const
+{
+   out << "stress:";
+   const char * names[] = { "birds", "missiles", "bombs", "fragments" };
+   for (int i = 0; i < 4; i++)
+      if (kinds & (1 << i))
+         out << ' ' << names[i];
+   out << ", " << frames << " frames a step, " << fixed << setprecision(1)
+       << STRESS_BUDGET << " ms a frame\n";
+   out << "   scale    objects    simulate ms (p99)      render ms (p99)       frame ms (p99)\n";
+
+   size_t cliff = 0;
+   for (const Step & step : steps)
+   {
+      // a step cut short by the end of the run says nothing
+      if ((int)step.simulate.size() < frames)
+         continue;
+
+      // the frame is the simulation and the drawing together
+      vector<double> frame = step.simulate;
+      for (size_t i = 0; i < step.render.size() && i < frame.size(); i++)
+         frame[i] += step.render[i];
+      bool over = p99(frame) > STRESS_BUDGET;
+      if (over && cliff == 0)
+         cliff = step.scale;
+
+      out << setw(8) << step.scale << setw(11) << step.liveMost << setprecision(3)
+          << setw(11) << mean(step.simulate) << " (" << setw(8) << p99(step.simulate) << ")";
+      if (step.render.empty())
+         out << setw(21) << "-";
+      else
+         out << setw(11) << mean(step.render) << " (" << setw(8) << p99(step.render) << ")";
+      out << setw(11) << mean(frame) << " (" << setw(8) << p99(frame) << ")"
+          << (over ? "  over" : "") << '\n';
+   }
+
+   if (cliff)
+      out << "1% of frames first went over " << setprecision(1) << STRESS_BUDGET
+          << " ms at " << cliff << " of each\n";
+   else
+      out << "no step went over " << setprecision(1) << STRESS_BUDGET << " ms\n";
+}
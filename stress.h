@@ -0,0 +1,80 @@
+/***********************************************************************
+ * Header File:
+ *    STRESS : How many of everything can a frame take?
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    A game never has more than a dozen birds and a couple of bombs, so
+ *    it never shows how animate() and drawing grow with the crowd. A
+ *    stress test plays one long level with no birds of its own and tops
+ *    the game up every frame to a load: so many birds, missiles, bombs
+ *    (each bursting into 20 shrapnel), and fragments. The load starts at
+ *    one of each and doubles every step. Each frame's time to simulate
+ *    and to draw is recorded separately, and the report is the curve of
+ *    both against the load, and where a frame first goes over the time
+ *    one step of the game has (33 ms).
+ *
+ *    The ramp stops at STRESS_MOST, or once an average frame is four
+ *    times over the budget, since by then the cliff has been found.
+ ************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "skeet.h"
+
+#define STRESS_FRAMES 90      // frames at each step of the load
+#define STRESS_MOST   65536   // the most of each kind we will try
+#define STRESS_BUDGET (1000.0 / FRAMES_PER_SECOND)   // milliseconds a frame has
+
+/*********************************************
+ * STRESS
+ * Ramp up the load and time every frame
+ *********************************************/
+class Stress
+{
+public:
+   // what can be ramped. The rest stay at none
+   enum { BIRDS = 1, MISSILES = 2, BOMBS = 4, FRAGMENTS = 8, ALL = 15 };
+
+   Stress(int kinds = ALL, int frames = STRESS_FRAMES, size_t most = STRESS_MOST);
+
+   // "all", or the kinds in a list like "birds,bombs". 0 if not understood
+   static int parseKinds(const std::string & text);
+
+   // the one level a stress test plays
+   static const Levels & getLevels();
+
+   // top [skeet] up to this step's load. Call before animate()
+   void fill(Skeet & skeet) const;
+
+   // how long the frame took to simulate and to draw, in milliseconds.
+   // [render] is negative when nothing was drawn. After enough frames
+   // this moves on to the next step
+   void record(const Skeet & skeet, double simulate, double render);
+
+   // how many of each kind this step, or 0 when done
+   size_t getScale() const { return done ? 0 : steps.back().scale; }
+   bool isDone() const     { return done; }
+
+   // the scaling curve
+   void report(std::ostream & out) const;
+
+private:
+   struct Step
+   {
+      size_t scale;                  // how many of each kind
+      size_t liveMost;               // the most objects of any frame
+      std::vector<double> simulate;  // milliseconds, frame by frame
+      std::vector<double> render;
+   };
+
+   int kinds;
+   int frames;
+   size_t most;
+   bool done;
+   std::vector<Step> steps;
+};
@@ -0,0 +1,156 @@
+/***********************************************************************
+ * Header File:
+ *    TEST COLLISION : Unit tests for the BirdBlock kernels
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    Every kernel this processor can run must find exactly the birds
+ *    timeOfImpact() says a bullet touches, no matter how many birds
+ *    there are or where the last one falls in a set of lanes.
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <cstdlib>
+#include <vector>
+#include "collision.h"
+
+/*********************************************
+ * TEST COLLISION
+ * The SIMD kernels against the scalar answer
+ *********************************************/
+class TestCollision
+{
+public:
+   void run()
+   {
+      collide_empty();
+      collide_oneHit();
+      collide_ignoresPadding();
+      collide_matchesTimeOfImpact();
+   }
+
+private:
+   // a number in [min, max]
+   static double random(double min, double max)
+   {
+      return min + ((double)rand() / (double)RAND_MAX * (max - min));
+   }
+
+   // every kernel this processor can run
+   static std::vector<Isa> supported()
+   {
+      std::vector<Isa> isas;
+      for (Isa isa : { ISA_SCALAR, ISA_SSE2, ISA_AVX2 })
+         if (isSupported(isa))
+            isas.push_back(isa);
+      return isas;
+   }
+
+   /*********************************************
+    * no birds, no hits
+    *********************************************/
+   void collide_empty()
+   {
+      for (Isa isa : supported())
+      {
+         // setup
+         BirdBlock block;
+         block.setIsa(isa);
+         std::vector<int> hits;
+         // exercise
+         block.collide(Position(0.0, 0.0), Velocity(1.0, 0.0), 1.0, hits);
+         // verify
+         assert(hits.empty());
+      }
+   }
+
+   /*********************************************
+    * a bullet flying straight at the middle bird of three
+    *********************************************/
+   void collide_oneHit()
+   {
+      for (Isa isa : supported())
+      {
+         // setup
+         BirdBlock block;
+         block.setIsa(isa);
+         block.add(Position(100.0, 200.0), Velocity(0.0, 0.0), 5.0);
+         block.add(Position(100.0, 100.0), Velocity(0.0, 0.0), 5.0);
+         block.add(Position(100.0,   0.0), Velocity(0.0, 0.0), 5.0);
+         std::vector<int> hits;
+         // exercise
+         block.collide(Position(120.0, 100.0), Velocity(-30.0, 0.0), 0.5, hits);
+         // verify
+         assert(hits.size() == 1);
+         assert(hits[0] == 1);
+      }
+   }
+
+   /*********************************************
+    * a bullet sitting on the empty slots past the last
+    * bird does not hit them
+    *********************************************/
+   void collide_ignoresPadding()
+   {
+      for (Isa isa : supported())
+      {
+         // setup
+         BirdBlock block;
+         block.setIsa(isa);
+         block.add(Position(500.0, 500.0), Velocity(0.0, 0.0), 5.0);
+         std::vector<int> hits;
+         // exercise
+         block.collide(Position(0.0, 0.0), Velocity(0.0, 0.0), 1.0, hits);
+         // verify
+         assert(hits.empty());
+      }
+   }
+
+   /*********************************************
+    * blocks of every size up to a few sets of lanes find
+    * the same birds as timeOfImpact(), in order
+    *********************************************/
+   void collide_matchesTimeOfImpact()
+   {
+      srand(707);
+      for (int trial = 0; trial < 2000; trial++)
+      {
+         // setup
+         int numBirds = trial % 13;
+         std::vector<Position> pts;
+         std::vector<Velocity> vs;
+         std::vector<double> radii;
+         for (int i = 0; i < numBirds; i++)
+         {
+            pts.push_back(Position(random(0.0, 100.0), random(0.0, 100.0)));
+            vs.push_back(Velocity(random(-8.0, 8.0), random(-8.0, 8.0)));
+            radii.push_back(random(15.0, 30.0));
+         }
+         Position ptBullet(random(0.0, 100.0), random(0.0, 100.0));
+         Velocity vBullet(random(-30.0, 30.0), random(-30.0, 30.0));
+         double radius = random(0.5, 5.0);
+         std::vector<int> expected;
+         for (int i = 0; i < numBirds; i++)
+         {
+            double time;
+            if (timeOfImpact(pts[i], vs[i], ptBullet, vBullet, radii[i] + radius, time))
+               expected.push_back(i);
+         }
+
+         for (Isa isa : supported())
+         {
+            BirdBlock block;
+            block.setIsa(isa);
+            for (int i = 0; i < numBirds; i++)
+               block.add(pts[i], vs[i], radii[i]);
+            std::vector<int> hits;
+            // exercise
+            block.collide(ptBullet, vBullet, radius, hits);
+            // verify
+            assert(hits == expected);
+         }
+      }
+   }
+};
@@ -0,0 +1,203 @@
+/***********************************************************************
+ * Header File:
+ *    TEST INPUT : Unit tests for getting the keys to the game
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The ring has to hand over everything in order, even between two
+ *    threads, and the input queue has to put every key event in the step
+ *    it happened in: no press lost, none merged with another.
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <chrono>
+#include <thread>
+#include "ring.h"
+#include "inputQueue.h"
+
+/*********************************************
+ * TEST INPUT
+ * Unit tests for Ring and InputQueue
+ *********************************************/
+class TestInput
+{
+public:
+   void run()
+   {
+      ring_inOrder();
+      ring_full();
+      ring_twoThreads();
+      take_everyPress();
+      take_laterStep();
+      take_arrows();
+      take_shift();
+   }
+
+private:
+   typedef InputQueue::Clock Clock;
+
+   /*********************************************
+    * first in, first out, around and around
+    *********************************************/
+   void ring_inOrder()
+   {
+      // setup
+      Ring<int, 4> ring;
+      // exercise and verify
+      assert(ring.empty() && ring.front() == NULL);
+      for (int i = 0; i < 10; i++)
+      {
+         assert(ring.push(i));
+         assert(ring.push(100 + i));
+         assert(ring.size() == 2);
+         assert(*ring.front() == i);
+         ring.pop();
+         assert(*ring.front() == 100 + i);
+         ring.pop();
+         assert(ring.empty());
+      }
+   }
+
+   /*********************************************
+    * a full ring turns the next one away
+    *********************************************/
+   void ring_full()
+   {
+      // setup
+      Ring<int, 8> ring;
+      for (int i = 0; i < 8; i++)
+         assert(ring.push(i));
+      // exercise
+      bool pushed = ring.push(8);
+      // verify
+      assert(!pushed);
+      assert(ring.size() == 8);
+      assert(*ring.front() == 0);
+      ring.pop();
+      assert(ring.push(8));
+   }
+
+   /*********************************************
+    * one thread pushing as fast as it can, this one
+    * taking as fast as it can, and nothing lost
+    *********************************************/
+   void ring_twoThreads()
+   {
+      // setup
+      const int count = 200000;
+      Ring<int, 64> ring;
+      std::thread producer([&ring]()
+      {
+         for (int i = 0; i < count; i++)
+            while (!ring.push(i))
+               std::this_thread::yield();
+      });
+      // exercise
+      int expected = 0;
+      while (expected < count)
+      {
+         const int * value = ring.front();
+         if (value == NULL)
+         {
+            std::this_thread::yield();
+            continue;
+         }
+         // verify
+         assert(*value == expected);
+         ring.pop();
+         expected++;
+      }
+      producer.join();
+      assert(ring.empty());
+   }
+
+   /*********************************************
+    * two presses in one step are two shots
+    *********************************************/
+   void take_everyPress()
+   {
+      // setup
+      InputQueue queue;
+      Clock::time_point start = Clock::now();
+      queue.push(InputQueue::SPACE, true, false, start);
+      queue.push(InputQueue::SPACE, true, false, start + std::chrono::milliseconds(5));
+      queue.push(InputQueue::M, true, false, start + std::chrono::milliseconds(6));
+      queue.push(InputQueue::B, true, false, start + std::chrono::milliseconds(7));
+      queue.push(InputQueue::B, false, false, start + std::chrono::milliseconds(8));
+      // exercise
+      Input input = queue.take(start + std::chrono::milliseconds(33));
+      Input next = queue.take(start + std::chrono::milliseconds(66));
+      // verify
+      assert(input.isSpace() == 2);
+      assert(input.isM() == 1);
+      assert(input.isB() == 1);
+      assert(next.isSpace() == 0 && next.isM() == 0 && next.isB() == 0);
+   }
+
+   /*********************************************
+    * a key after the step was due waits for the next
+    *********************************************/
+   void take_laterStep()
+   {
+      // setup
+      InputQueue queue;
+      Clock::time_point start = Clock::now();
+      queue.push(InputQueue::SPACE, true, false, start + std::chrono::milliseconds(40));
+      // exercise
+      Input first = queue.take(start + std::chrono::milliseconds(33));
+      Input second = queue.take(start + std::chrono::milliseconds(66));
+      // verify
+      assert(first.isSpace() == 0);
+      assert(second.isSpace() == 1);
+   }
+
+   /*********************************************
+    * held arrows count up, a tap is one step,
+    * and letting go is none
+    *********************************************/
+   void take_arrows()
+   {
+      // setup
+      InputQueue queue;
+      Clock::time_point start = Clock::now();
+      auto at = [start](int step) { return start + std::chrono::milliseconds(33 * step); };
+      queue.push(InputQueue::UP, true, false, at(0));
+      queue.push(InputQueue::LEFT, true, false, at(0) + std::chrono::milliseconds(1));
+      queue.push(InputQueue::LEFT, false, false, at(0) + std::chrono::milliseconds(9));
+      queue.push(InputQueue::UP, false, false, at(3) + std::chrono::milliseconds(1));
+      // exercise and verify
+      Input input = queue.take(at(1));
+      assert(input.isUp() == 1);
+      assert(input.isLeft() == 1);
+      input = queue.take(at(2));
+      assert(input.isUp() == 2);
+      assert(input.isLeft() == 0);
+      input = queue.take(at(3));
+      assert(input.isUp() == 3);
+      input = queue.take(at(4));
+      assert(input.isUp() == 0);
+      assert(input.isDown() == 0 && input.isRight() == 0);
+   }
+
+   /*********************************************
+    * shift is whatever it was at the last key
+    *********************************************/
+   void take_shift()
+   {
+      // setup
+      InputQueue queue;
+      Clock::time_point start = Clock::now();
+      queue.push(InputQueue::DOWN, true, true, start);
+      // exercise
+      Input first = queue.take(start);
+      Input second = queue.take(start + std::chrono::milliseconds(33));
+      queue.push(InputQueue::DOWN, false, false, start + std::chrono::milliseconds(40));
+      Input third = queue.take(start + std::chrono::milliseconds(66));
+      // verify
+      assert(first.isShift() && first.isDown() == 1);
+      assert(second.isShift() && second.isDown() == 2);
+      assert(!third.isShift() && third.isDown() == 0);
+   }
+};
@@ -0,0 +1,223 @@
+/***********************************************************************
+ * Header File:
+ *    TEST JOBS : Unit tests for the job system
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    parallelFor() has to cover every index exactly once, and a game
+ *    animated with jobs has to play out exactly like one without. The
+ *    games use a tiny grain so the parallel paths run even though there
+ *    are only a handful of birds and bullets. Games on threads of their
+ *    own, each with a screen of its own, have to play as if alone.
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <thread>
+#include <vector>
+#include "jobs.h"
+#include "effect.h"
+#include "skeet.h"
+#include "bot.h"
+
+/*********************************************
+ * TEST JOBS
+ * Unit tests for JobSystem and what uses it
+ *********************************************/
+class TestJobs
+{
+public:
+   void run()
+   {
+      parallelFor_everyIndexOnce();
+      parallelFor_oneThread();
+      parallelFor_nothing();
+      parallelFor_again();
+      fly_sameAsOneThread();
+      animate_sameGame();
+      play_ownThreads();
+   }
+
+private:
+   /*********************************************
+    * every index in exactly one chunk, and every
+    * chunk where its number says it is
+    *********************************************/
+   void parallelFor_everyIndexOnce()
+   {
+      // setup
+      JobSystem jobs(4);
+      std::vector<int> count(1000, 0);
+      std::vector<size_t> first(143, 1000);
+      // exercise
+      jobs.parallelFor(count.size(), 7, [&](size_t chunk, size_t begin, size_t end)
+      {
+         first[chunk] = begin;
+         for (size_t i = begin; i < end; i++)
+            count[i]++;
+      });
+      // verify
+      for (int n : count)
+         assert(n == 1);
+      for (size_t chunk = 0; chunk < first.size(); chunk++)
+         assert(first[chunk] == chunk * 7);
+   }
+
+   /*********************************************
+    * with one thread the caller does all the work
+    *********************************************/
+   void parallelFor_oneThread()
+   {
+      // setup
+      JobSystem jobs(1);
+      size_t sum = 0;
+      // exercise
+      jobs.parallelFor(100, 10, [&sum](size_t chunk, size_t begin, size_t end)
+      {
+         for (size_t i = begin; i < end; i++)
+            sum += i;
+      });
+      // verify
+      assert(jobs.getThreads() == 1);
+      assert(sum == 4950);
+   }
+
+   /*********************************************
+    * nothing to do is not an error
+    *********************************************/
+   void parallelFor_nothing()
+   {
+      // setup
+      JobSystem jobs(3);
+      bool called = false;
+      // exercise
+      jobs.parallelFor(0, 10, [&called](size_t, size_t, size_t) { called = true; });
+      // verify
+      assert(!called);
+   }
+
+   /*********************************************
+    * the same job system, loop after loop
+    *********************************************/
+   void parallelFor_again()
+   {
+      // setup
+      JobSystem jobs(3);
+      std::vector<long> values(300, 0);
+      // exercise
+      for (int pass = 0; pass < 200; pass++)
+         jobs.parallelFor(values.size(), 16, [&values](size_t, size_t begin, size_t end)
+         {
+            for (size_t i = begin; i < end; i++)
+               values[i] += (long)i;
+         });
+      // verify
+      for (size_t i = 0; i < values.size(); i++)
+         assert(values[i] == 200 * (long)i);
+   }
+
+   /*********************************************
+    * fragments flown in chunks end up exactly where
+    * they would flying one at a time
+    *********************************************/
+   void fly_sameAsOneThread()
+   {
+      // setup
+      JobSystem jobs(4);
+      Random random(88);
+      Effects lhs;
+      for (int i = 0; i < 500; i++)
+         lhs.addFragment(Position(random.nextDouble(0.0, 800.0), random.nextDouble(0.0, 800.0)),
+                         Velocity(random.nextDouble(-9.0, 9.0), random.nextDouble(-9.0, 9.0)), random);
+      Effects rhs = lhs;
+      // exercise
+      for (int frame = 0; frame < 60; frame++)
+      {
+         lhs.fly();
+         rhs.fly(&jobs, 32);
+         // verify
+         const Fragments & fragmentsLhs = lhs.getFragments();
+         const Fragments & fragmentsRhs = rhs.getFragments();
+         assert(fragmentsLhs.size() == fragmentsRhs.size());
+         for (size_t i = 0; i < fragmentsLhs.size(); i++)
+         {
+            assert(fragmentsLhs.getPosition(i).getX() == fragmentsRhs.getPosition(i).getX());
+            assert(fragmentsLhs.getPosition(i).getY() == fragmentsRhs.getPosition(i).getY());
+            assert(fragmentsLhs.getAge(i) == fragmentsRhs.getAge(i));
+         }
+      }
+      assert(lhs.getFragments().size() == 0);
+   }
+
+   /*********************************************
+    * a whole game with jobs is the same game
+    *********************************************/
+   void animate_sameGame()
+   {
+      // setup
+      JobSystem jobs(3);
+      Position dimensions(800.0, 800.0);
+      Skeet lhs(dimensions, 4321);
+      Skeet rhs(dimensions, 4321);
+      rhs.setJobs(&jobs, 2);
+      RandomBot botLhs(99);
+      RandomBot botRhs(99);
+      // exercise
+      while (!lhs.getTime().isGameOver())
+      {
+         lhs.interact(botLhs.play(lhs));
+         lhs.animate();
+         rhs.interact(botRhs.play(rhs));
+         rhs.animate();
+         // verify
+         assert(lhs.getLiveObjects() == rhs.getLiveObjects());
+         assert(lhs.getScore().getPoints() == rhs.getScore().getPoints());
+         assert(lhs.getEffects().getStreeks().size() == rhs.getEffects().getStreeks().size());
+      }
+      assert(rhs.getTime().isGameOver());
+      assert(lhs.getHitRatio().getKilled() == rhs.getHitRatio().getKilled());
+      assert(lhs.getHitRatio().getMissed() == rhs.getHitRatio().getMissed());
+   }
+
+   /*********************************************
+    * two games of different sizes at the same time
+    * end just as they do one after the other
+    *********************************************/
+   void play_ownThreads()
+   {
+      // setup
+      Position large(800.0, 800.0);
+      Position small(400.0, 600.0);
+      int aloneLarge = play(large, 4321);
+      int aloneSmall = play(small, 4321);
+      int togetherLarge = 0;
+      int togetherSmall = 0;
+      // exercise
+      std::thread other([&small, &togetherSmall]() { togetherSmall = play(small, 4321); });
+      togetherLarge = play(large, 4321);
+      other.join();
+      // verify
+      assert(Skeet(small, 4321).getGun().getPosition().getX() == 400.0);
+      Random random(1);
+      Points points(small, Position(300.0, 100.0), 10, random);
+      points.update(random);
+      assert(points.getPosition().getX() < 300.0);   // toward the middle
+      assert(aloneLarge != aloneSmall);
+      assert(togetherLarge == aloneLarge);
+      assert(togetherSmall == aloneSmall);
+   }
+
+   // a whole game with the random bot; the final score
+   static int play(const Position & dimensions, uint64_t seed)
+   {
+      Skeet skeet(dimensions, seed);
+      RandomBot bot(99);
+      while (!skeet.getTime().isGameOver())
+      {
+         skeet.interact(bot.play(skeet));
+         skeet.animate();
+      }
+      return skeet.getScore().getPoints();
+   }
+};
@@ -0,0 +1,195 @@
+/***********************************************************************
+ * Header File:
+ *    TEST LEVELS : Unit tests for reading the levels
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    Every line of a level file has to end up in the table spawn()
+ *    walks, a bad line has to be caught with its line number and leave
+ *    the old levels alone, and a game has to play the levels it is given.
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <sstream>
+#include <string>
+#include "level.h"
+#include "skeet.h"
+#include "bot.h"
+
+/*********************************************
+ * TEST LEVELS
+ * Unit tests for Levels
+ *********************************************/
+class TestLevels
+{
+public:
+   void run()
+   {
+      standard_fourLevels();
+      read_everyField();
+      read_badLine();
+      read_noLevels();
+      play_swarm();
+      play_length();
+   }
+
+private:
+   /*********************************************
+    * the levels the game has always had
+    *********************************************/
+   void standard_fourLevels()
+   {
+      // exercise
+      const Levels & levels = Levels::standard();
+      // verify
+      assert(levels.size() == 4);
+      assert(levels.getSeconds() == std::vector<int>({ 30, 30, 45, 45 }));
+      assert(levels[1].spawners.size() == 2);
+      assert(levels[1].spawners[0].whenEmpty);
+      assert(levels[4].spawners.size() == 5);
+      assert(levels[4].spawners[4].kind == Spawner::CRAZY);
+   }
+
+   /*********************************************
+    * each word of a line lands where it belongs
+    *********************************************/
+   void read_everyField()
+   {
+      // setup
+      Levels levels;
+      std::istringstream in(
+         "# a comment\n"
+         "level 12\n"
+         "\n"
+         "   sinker 11.5 2.25 -7 3 empty x4   # another\n"
+         "level 20\n"
+         "level 8\n"
+         "floater 9 1 2 1\n");
+      // exercise
+      bool ok = levels.read(in);
+      // verify
+      assert(ok);
+      assert(levels.getError().empty());
+      assert(levels.size() == 3);
+      assert(levels.getSeconds() == std::vector<int>({ 12, 20, 8 }));
+      const Spawner & sinker = levels[1].spawners[0];
+      assert(sinker.kind == Spawner::SINKER);
+      assert(sinker.radius == 11.5);
+      assert(sinker.speed == 2.25);
+      assert(sinker.points == -7);
+      assert(sinker.odds == 3);
+      assert(sinker.whenEmpty);
+      assert(sinker.count == 4);
+      assert(levels[2].spawners.empty());
+      const Spawner & floater = levels[3].spawners[0];
+      assert(floater.kind == Spawner::FLOATER);
+      assert(!floater.whenEmpty);
+      assert(floater.count == 1);
+   }
+
+   /*********************************************
+    * a bad line says where it is and changes nothing
+    *********************************************/
+   void read_badLine()
+   {
+      const char * bad[] =
+      {
+         "level 30\nstandard 30 7 10 15\nstandard 30 7 ten 15\n",   // not a number
+         "level 30\nstandard 30 7 10 15\neagle 30 7 10 15\n",       // not a bird
+         "level 30\nstandard 30 7 10 15\nlevel 4\n",                // shorter than the status
+         "level 30\nstandard 30 7 10 15\nstandard 30 7 10 0\n",     // no chance at all
+         "level 30\nstandard 30 7 10 15\nstandard 30 7 10 15 x0\n", // no birds at once
+         "level 30\nstandard 30 7 10 15\nstandard 30 7 10 15 full\n",
+         "level 30\nstandard 30 7 10 15\ncrazy 5 4 30 120\n",         // too small to draw
+         "level 30\nstandard 30 7 10 15\nlevel 4294967326\n",         // not an int
+         "level 30\nstandard 30 7 10 15\nlevel 80000000\n",           // too many frames
+         "level 30\nstandard 30 7 10 15\nstandard 30 7 10 15 x4294967297\n",
+         "level 30\nstandard 30 7 10 15\nstandard 30 7 10 15 x1001\n"  // too many at once
+      };
+      for (const char * text : bad)
+      {
+         // setup
+         Levels levels;
+         std::istringstream in(text);
+         // exercise
+         bool ok = levels.read(in);
+         // verify
+         assert(!ok);
+         assert(levels.getError().find("line 3") == 0);
+         assert(levels.size() == 4);
+      }
+   }
+
+   /*********************************************
+    * birds need a level, and a game needs a level
+    *********************************************/
+   void read_noLevels()
+   {
+      // setup
+      Levels levels;
+      std::istringstream birdFirst("standard 30 7 10 15\nlevel 30\n");
+      std::istringstream empty("# nothing\n");
+      // exercise and verify
+      assert(!levels.read(birdFirst));
+      assert(levels.getError().find("line 1") == 0);
+      assert(!levels.read(empty));
+      assert(levels.getError() == "no levels");
+      assert(levels.size() == 4);
+      assert(!levels.load("no such file.levels"));
+   }
+
+   /*********************************************
+    * odds of 1 with x3 is three birds every frame
+    *********************************************/
+   void play_swarm()
+   {
+      // setup
+      Levels levels;
+      std::istringstream in("level 20\nstandard 10 3 5 1 x3\n");
+      assert(levels.read(in));
+      Position dimensions(800.0, 800.0);
+      Skeet skeet(dimensions, 5, &levels);
+      IdleBot bot;
+      while (!skeet.isPlaying())
+      {
+         skeet.interact(bot.play(skeet));
+         skeet.animate();
+      }
+      // exercise
+      for (int frame = 1; frame < 20; frame++)
+      {
+         skeet.interact(bot.play(skeet));
+         skeet.animate();
+      }
+      // verify
+      assert(skeet.getBirds().size() == 60);
+   }
+
+   /*********************************************
+    * the game is over when the last level ends
+    *********************************************/
+   void play_length()
+   {
+      // setup
+      Levels levels;
+      std::istringstream in("level 7\nlevel 6\n");
+      assert(levels.read(in));
+      Position dimensions(800.0, 800.0);
+      Skeet skeet(dimensions, 5, &levels);
+      IdleBot bot;
+      int frames = 0;
+      // exercise
+      while (!skeet.getTime().isGameOver())
+      {
+         skeet.interact(bot.play(skeet));
+         skeet.animate();
+         frames++;
+      }
+      // verify
+      assert(frames > 13 * FRAMES_PER_SECOND);
+      assert(frames < 14 * FRAMES_PER_SECOND);
+      assert(skeet.getBirds().size() == 0);
+   }
+};
@@ -0,0 +1,124 @@
+/***********************************************************************
+ * Header File:
+ *    TEST PACER : Unit tests for frame pacing
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The steps are counted at times the tests make up, so they come out
+ *    exactly. Waiting for a frame really waits, and a busy machine can
+ *    make it late but never early, so that is all its test checks.
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <chrono>
+#include "pacer.h"
+
+/*********************************************
+ * TEST PACER
+ * Unit tests for Pacer
+ *********************************************/
+class TestPacer
+{
+   typedef Pacer::Clock Clock;
+   typedef std::chrono::milliseconds milliseconds;
+   typedef std::chrono::microseconds microseconds;
+
+public:
+   void run()
+   {
+      setFramesPerSecond_roundTrip();
+      wait_keepsTheRate();
+      stepsDue_wholeSteps();
+      stepsDue_most();
+      stepsDue_exactlyMost();
+   }
+
+private:
+   /*********************************************
+    * the rate we ask for is the rate we get back
+    *********************************************/
+   void setFramesPerSecond_roundTrip()
+   {
+      // setup
+      Pacer pacer;
+      // exercise
+      pacer.setFramesPerSecond(144.0);
+      // verify
+      assert(pacer.getFramesPerSecond() > 143.99);
+      assert(pacer.getFramesPerSecond() < 144.01);
+   }
+
+   /*********************************************
+    * 200 frames a second is 5 milliseconds a frame,
+    * or more, never less
+    *********************************************/
+   void wait_keepsTheRate()
+   {
+      // setup
+      Pacer pacer(200.0);
+      auto begin = std::chrono::steady_clock::now();
+      // exercise
+      for (int i = 0; i < 40; i++)
+         pacer.wait();
+      // verify
+      double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+      assert(seconds > 0.19);
+      assert(pacer.getFrameTime() > 0.0);
+      assert(pacer.getJitter() >= 0.0);
+   }
+
+   /*********************************************
+    * three and a half periods is three steps, and
+    * the half carries over to the next call
+    *********************************************/
+   void stepsDue_wholeSteps()
+   {
+      // setup
+      Pacer pacer(100.0);
+      Clock::time_point start = Clock::now();
+      pacer.stepsDue(5, start);
+      // exercise
+      int steps = pacer.stepsDue(5, start + milliseconds(35));
+      int later = pacer.stepsDue(5, start + milliseconds(40));
+      // verify
+      assert(steps == 3);
+      assert(later == 1);
+   }
+
+   /*********************************************
+    * a long stall never asks for more than [most] steps
+    *********************************************/
+   void stepsDue_most()
+   {
+      // setup
+      Pacer pacer(1000.0);
+      Clock::time_point start = Clock::now();
+      pacer.stepsDue(4, start);
+      // exercise
+      int steps = pacer.stepsDue(4, start + milliseconds(20));
+      // verify
+      assert(steps == 4);
+      assert(pacer.getAlpha() < 0.01);
+      assert(pacer.stepsDue(4, start + microseconds(20500)) == 0);
+   }
+
+   /*********************************************
+    * three and a bit periods with at most three is
+    * not a stall: the bit carries over
+    *********************************************/
+   void stepsDue_exactlyMost()
+   {
+      // setup
+      Pacer pacer(10.0);
+      Clock::time_point start = Clock::now();
+      pacer.stepsDue(3, start);
+      // exercise
+      int steps = pacer.stepsDue(3, start + milliseconds(330));
+      // verify
+      assert(steps == 3);
+      assert(pacer.getAlpha() > 0.29 && pacer.getAlpha() < 0.31);
+      assert(pacer.getStepTime() <= start + milliseconds(300));
+   }
+};
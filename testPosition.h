@@ -0,0 +1,251 @@
+/***********************************************************************
+ * Header File:
+ *    TEST POSITION : Unit tests for Position and Velocity
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The closed-form minimumDistance() and timeOfImpact() are checked
+ *    against the sampling loop minimumDistance() used to be.
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include "position.h"
+
+/*********************************************
+ * TEST POSITION
+ * Unit tests for the closest approach of two moving things
+ *********************************************/
+class TestPosition
+{
+public:
+   void run()
+   {
+      minimumDistance_headOn();
+      minimumDistance_parallel();
+      minimumDistance_movingApart();
+      minimumDistance_matchesSampler();
+      timeOfImpact_headOn();
+      timeOfImpact_alreadyTouching();
+      timeOfImpact_miss();
+      timeOfImpact_matchesSampler();
+   }
+
+private:
+   /*********************************************
+    * SAMPLER
+    * The way minimumDistance() used to work: step through the frame in
+    * slices of 1/dMax and keep the closest. The old code called the int
+    * abs(), rounding dMax down; here it uses the double one it meant.
+    *********************************************/
+   static double sampler(const Position & pt1, const Velocity & v1,
+                         const Position & pt2, const Velocity & v2)
+   {
+      double d1 = max(std::abs(v1.getDx()), std::abs(v1.getDy()));
+      double d2 = max(std::abs(v2.getDx()), std::abs(v2.getDy()));
+      double dMax = max(d1, d2);
+      assert(dMax > 0.0);
+
+      double distMin = std::numeric_limits<double>::max();
+      double slice = 1.0 / dMax;
+      for (double percent = 0.0; percent <= 1.0; percent += slice)
+      {
+         Position pointLhs(pt1.getX() + (v1.getDx() * percent),
+                           pt1.getY() + (v1.getDy() * percent));
+         Position pointRhs(pt2.getX() + (v2.getDx() * percent),
+                           pt2.getY() + (v2.getDy() * percent));
+         double distSquared =
+            ((pointLhs.getX() - pointRhs.getX()) * (pointLhs.getX() - pointRhs.getX())) +
+            ((pointLhs.getY() - pointRhs.getY()) * (pointLhs.getY() - pointRhs.getY()));
+         distMin = min(distMin, distSquared);
+      }
+      return sqrt(distMin);
+   }
+
+   // the largest the sampler can be off: one slice of relative motion
+   static double samplerError(const Velocity & v1, const Velocity & v2)
+   {
+      double d1 = max(std::abs(v1.getDx()), std::abs(v1.getDy()));
+      double d2 = max(std::abs(v2.getDx()), std::abs(v2.getDy()));
+      double wx = v1.getDx() - v2.getDx();
+      double wy = v1.getDy() - v2.getDy();
+      return sqrt(wx * wx + wy * wy) / max(d1, d2);
+   }
+
+   // a number in [min, max]
+   static double random(double min, double max)
+   {
+      return min + ((double)rand() / (double)RAND_MAX * (max - min));
+   }
+
+   static bool closeEnough(double lhs, double rhs, double tolerance = 0.0001)
+   {
+      return std::abs(lhs - rhs) <= tolerance;
+   }
+
+   /*********************************************
+    * a bullet flying straight at a bird that sits still
+    *********************************************/
+   void minimumDistance_headOn()
+   {
+      // setup
+      Position ptBird(100.0, 100.0);
+      Velocity vBird(0.0, 0.0);
+      Position ptBullet(120.0, 100.0);
+      Velocity vBullet(-30.0, 0.0);
+      // exercise
+      double distance = minimumDistance(ptBird, vBird, ptBullet, vBullet);
+      // verify
+      assert(closeEnough(distance, 0.0));
+   }
+
+   /*********************************************
+    * two things flying side by side never get closer
+    *********************************************/
+   void minimumDistance_parallel()
+   {
+      // setup
+      Position pt1(0.0, 0.0);
+      Position pt2(0.0, 7.0);
+      Velocity v(5.0, 0.0);
+      // exercise
+      double distance = minimumDistance(pt1, v, pt2, v);
+      // verify
+      assert(closeEnough(distance, 7.0));
+   }
+
+   /*********************************************
+    * closest at the start of the frame
+    *********************************************/
+   void minimumDistance_movingApart()
+   {
+      // setup
+      Position pt1(0.0, 0.0);
+      Velocity v1(-3.0, -4.0);
+      Position pt2(3.0, 4.0);
+      Velocity v2(3.0, 4.0);
+      // exercise
+      double distance = minimumDistance(pt1, v1, pt2, v2);
+      // verify
+      assert(closeEnough(distance, 5.0));
+   }
+
+   /*********************************************
+    * the exact answer is never more than the sampler finds,
+    * and never less than one slice short of it
+    *********************************************/
+   void minimumDistance_matchesSampler()
+   {
+      srand(331);
+      for (int i = 0; i < 10000; i++)
+      {
+         // setup: a bird and a bullet somewhere near each other
+         Position ptBird(random(0.0, 100.0), random(0.0, 100.0));
+         Velocity vBird(random(-8.0, 8.0), random(-8.0, 8.0));
+         Position ptBullet(random(0.0, 100.0), random(0.0, 100.0));
+         Velocity vBullet(random(-30.0, 30.0), random(-30.0, 30.0));
+         // exercise
+         double exact = minimumDistance(ptBird, vBird, ptBullet, vBullet);
+         double sampled = sampler(ptBird, vBird, ptBullet, vBullet);
+         // verify
+         assert(exact <= sampled + 0.000001);
+         assert(sampled - exact <= samplerError(vBird, vBullet) + 0.000001);
+      }
+   }
+
+   /*********************************************
+    * a bullet 20 away closing at 30 a frame touches a
+    * radius 5 bird when it has covered 15 of it
+    *********************************************/
+   void timeOfImpact_headOn()
+   {
+      // setup
+      Position ptBird(100.0, 100.0);
+      Velocity vBird(0.0, 0.0);
+      Position ptBullet(120.0, 100.0);
+      Velocity vBullet(-30.0, 0.0);
+      double time = -1.0;
+      // exercise
+      bool hit = timeOfImpact(ptBird, vBird, ptBullet, vBullet, 5.0, time);
+      // verify
+      assert(hit);
+      assert(closeEnough(time, 0.5));
+   }
+
+   /*********************************************
+    * overlapping at the start of the frame is a hit right away
+    *********************************************/
+   void timeOfImpact_alreadyTouching()
+   {
+      // setup
+      Position pt1(0.0, 0.0);
+      Velocity v1(1.0, 0.0);
+      Position pt2(2.0, 0.0);
+      Velocity v2(3.0, 0.0);
+      double time = -1.0;
+      // exercise
+      bool hit = timeOfImpact(pt1, v1, pt2, v2, 5.0, time);
+      // verify
+      assert(hit);
+      assert(time == 0.0);
+   }
+
+   /*********************************************
+    * passing by just outside the radius is not a hit
+    *********************************************/
+   void timeOfImpact_miss()
+   {
+      // setup
+      Position ptBird(100.0, 100.0);
+      Velocity vBird(0.0, 0.0);
+      Position ptBullet(120.0, 105.1);
+      Velocity vBullet(-30.0, 0.0);
+      double time = -1.0;
+      // exercise
+      bool hit = timeOfImpact(ptBird, vBird, ptBullet, vBullet, 5.0, time);
+      // verify
+      assert(!hit);
+      assert(time == -1.0);
+   }
+
+   /*********************************************
+    * everything the sampler calls a hit is a hit, and the
+    * time of impact really is where they touch
+    *********************************************/
+   void timeOfImpact_matchesSampler()
+   {
+      srand(231);
+      for (int i = 0; i < 10000; i++)
+      {
+         // setup
+         Position ptBird(random(0.0, 100.0), random(0.0, 100.0));
+         Velocity vBird(random(-8.0, 8.0), random(-8.0, 8.0));
+         Position ptBullet(random(0.0, 100.0), random(0.0, 100.0));
+         Velocity vBullet(random(-30.0, 30.0), random(-30.0, 30.0));
+         double radius = random(16.0, 35.0);
+         double time = -1.0;
+         // exercise
+         bool hit = timeOfImpact(ptBird, vBird, ptBullet, vBullet, radius, time);
+         // verify
+         if (radius > sampler(ptBird, vBird, ptBullet, vBullet))
+            assert(hit);
+         assert(hit == (radius > minimumDistance(ptBird, vBird, ptBullet, vBullet)));
+         if (hit)
+         {
+            assert(0.0 <= time && time <= 1.0);
+            Position pt1(ptBird.getX() + vBird.getDx() * time,
+                         ptBird.getY() + vBird.getDy() * time);
+            Position pt2(ptBullet.getX() + vBullet.getDx() * time,
+                         ptBullet.getY() + vBullet.getDy() * time);
+            double distance = sqrt((pt1.getX() - pt2.getX()) * (pt1.getX() - pt2.getX()) +
+                                   (pt1.getY() - pt2.getY()) * (pt1.getY() - pt2.getY()));
+            assert(distance <= radius + 0.000001);
+            assert(time == 0.0 || closeEnough(distance, radius));
+         }
+      }
+   }
+};
@@ -0,0 +1,170 @@
+/***********************************************************************
+ * Header File:
+ *    TEST PROFILER : Unit tests for the frame profiler
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    Most of these feed the profiler known times with add() so the
+ *    statistics can be checked exactly. Only one test uses the clock.
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include "profiler.h"
+
+/*********************************************
+ * TEST PROFILER
+ * Unit tests for Profiler and ProfileScope
+ *********************************************/
+class TestProfiler
+{
+public:
+   void run()
+   {
+      scope_disabled();
+      scope_enabled();
+      add_twiceInAFrame();
+      statistics_known();
+      endFrame_skipsStagesThatDidNotRun();
+      csv_oneLinePerFrame();
+   }
+
+private:
+   static Profiler::Clock::duration ms(int milliseconds)
+   {
+      return std::chrono::milliseconds(milliseconds);
+   }
+
+   /*********************************************
+    * a disabled profiler records nothing
+    *********************************************/
+   void scope_disabled()
+   {
+      // setup
+      Profiler profiler;
+      // exercise
+      {
+         ProfileScope scope(&profiler, STAGE_MOVE);
+      }
+      profiler.endFrame();
+      // verify
+      assert(profiler.getFrames() == 1);
+      assert(profiler.getAverage(STAGE_MOVE) == 0.0);
+   }
+
+   /*********************************************
+    * an enabled scope counts the time until the block ends
+    *********************************************/
+   void scope_enabled()
+   {
+      // setup
+      Profiler profiler;
+      profiler.setEnabled(true);
+      // exercise
+      {
+         ProfileScope scope(&profiler, STAGE_HITS);
+         std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      }
+      profiler.endFrame();
+      // verify
+      assert(profiler.getAverage(STAGE_HITS) >= 2.0);
+      assert(profiler.getAverage(STAGE_SPAWN) == 0.0);
+   }
+
+   /*********************************************
+    * two steps in one frame add up
+    *********************************************/
+   void add_twiceInAFrame()
+   {
+      // setup
+      Profiler profiler;
+      // exercise
+      profiler.add(STAGE_ADVANCE, ms(3));
+      profiler.add(STAGE_ADVANCE, ms(4));
+      profiler.endFrame();
+      // verify
+      assert(profiler.getMin(STAGE_ADVANCE) == 7.0);
+      assert(profiler.getAverage(STAGE_ADVANCE) == 7.0);
+   }
+
+   /*********************************************
+    * 1 through 100 ms: the fastest is 1, the average
+    * 50.5, and 99 frames in 100 take 99 or less
+    *********************************************/
+   void statistics_known()
+   {
+      // setup
+      Profiler profiler;
+      // exercise
+      for (int i = 100; i >= 1; i--)
+      {
+         profiler.add(STAGE_SPAWN, ms(i));
+         profiler.endFrame();
+      }
+      // verify
+      assert(profiler.getMin(STAGE_SPAWN) == 1.0);
+      assert(profiler.getAverage(STAGE_SPAWN) == 50.5);
+      assert(profiler.getP99(STAGE_SPAWN) == 99.0);
+      assert(profiler.getFrames() == 100);
+   }
+
+   /*********************************************
+    * a frame where the simulation did not step does
+    * not count as a zero for the simulation stages
+    *********************************************/
+   void endFrame_skipsStagesThatDidNotRun()
+   {
+      // setup
+      Profiler profiler;
+      profiler.add(STAGE_MOVE, ms(5));
+      profiler.endFrame();
+      // exercise
+      profiler.add(STAGE_DRAW_BIRDS, ms(1));
+      profiler.endFrame();
+      // verify
+      assert(profiler.getMin(STAGE_MOVE) == 5.0);
+      assert(profiler.getAverage(STAGE_DRAW_BIRDS) == 1.0);
+   }
+
+   /*********************************************
+    * a header, then one line per frame with an empty
+    * column for each stage that did not run
+    *********************************************/
+   void csv_oneLinePerFrame()
+   {
+      // setup
+      const char * fileName = "testProfiler.csv";
+      std::string header;
+      std::string first;
+      std::string second;
+      std::string end;
+      {
+         Profiler profiler;
+         bool opened = profiler.openCsv(fileName);
+         assert(opened);
+         // exercise
+         profiler.add(STAGE_SPAWN, ms(3));
+         profiler.endFrame();
+         profiler.endFrame();
+      }
+      std::ifstream fin(fileName);
+      std::getline(fin, header);
+      std::getline(fin, first);
+      std::getline(fin, second);
+      bool more = (bool)std::getline(fin, end);
+      fin.close();
+      // verify
+      assert(header.find("frame,interact,spawn,advance") == 0);
+      assert(first.find("0,,3,,") == 0);
+      assert(second.find("1,,,,") == 0);
+      assert(!more);
+      // teardown
+      remove(fileName);
+   }
+};
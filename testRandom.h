@@ -0,0 +1,134 @@
+/***********************************************************************
+ * Header File:
+ *    TEST RANDOM : Unit tests for Random and for replaying a game
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The same seed has to give the same numbers, and the same seed and
+ *    input have to give the same game.
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include "random.h"
+#include "skeet.h"
+#include "bot.h"
+
+/*********************************************
+ * TEST RANDOM
+ * Unit tests for the random numbers of a game
+ *********************************************/
+class TestRandom
+{
+public:
+   void run()
+   {
+      next_sameSeed();
+      next_differentSeed();
+      nextInt_range();
+      nextDouble_range();
+      skeet_sameSeedSameGame();
+   }
+
+private:
+   /*********************************************
+    * two generators from the same seed agree
+    *********************************************/
+   void next_sameSeed()
+   {
+      // setup
+      Random lhs(42);
+      Random rhs(42);
+      // exercise and verify
+      for (int i = 0; i < 1000; i++)
+         assert(lhs.next() == rhs.next());
+   }
+
+   /*********************************************
+    * two generators from neighboring seeds do not
+    *********************************************/
+   void next_differentSeed()
+   {
+      // setup
+      Random lhs(42);
+      Random rhs(43);
+      int same = 0;
+      // exercise
+      for (int i = 0; i < 1000; i++)
+         if (lhs.next() == rhs.next())
+            same++;
+      // verify
+      assert(same == 0);
+   }
+
+   /*********************************************
+    * every value from min up to but not including max
+    * comes up, and nothing else does
+    *********************************************/
+   void nextInt_range()
+   {
+      // setup
+      Random random(331);
+      int counts[5] = { 0, 0, 0, 0, 0 };
+      // exercise
+      for (int i = 0; i < 10000; i++)
+      {
+         int num = random.nextInt(-2, 3);
+         assert(-2 <= num && num < 3);
+         counts[num + 2]++;
+      }
+      // verify
+      for (int count : counts)
+         assert(count > 1500);
+   }
+
+   /*********************************************
+    * doubles stay inside [min, max]
+    *********************************************/
+   void nextDouble_range()
+   {
+      // setup
+      Random random(331);
+      double low = 1.0;
+      double high = 0.0;
+      // exercise
+      for (int i = 0; i < 10000; i++)
+      {
+         double num = random.nextDouble(0.4, 1.0);
+         assert(0.4 <= num && num <= 1.0);
+         low = num < low ? num : low;
+         high = num > high ? num : high;
+      }
+      // verify
+      assert(low < 0.41);
+      assert(high > 0.99);
+   }
+
+   /*********************************************
+    * two games from the same seed with the same bot
+    * play out the same, frame for frame
+    *********************************************/
+   void skeet_sameSeedSameGame()
+   {
+      // setup
+      Position dimensions(800.0, 800.0);
+      Skeet lhs(dimensions, 2024);
+      Skeet rhs(dimensions, 2024);
+      AimBot botLhs;
+      AimBot botRhs;
+      // exercise
+      while (!lhs.getTime().isGameOver())
+      {
+         lhs.interact(botLhs.play(lhs));
+         lhs.animate();
+         rhs.interact(botRhs.play(rhs));
+         rhs.animate();
+         // verify
+         assert(lhs.getLiveObjects() == rhs.getLiveObjects());
+         assert(lhs.getScore().getPoints() == rhs.getScore().getPoints());
+      }
+      assert(rhs.getTime().isGameOver());
+      assert(lhs.getHitRatio().getKilled() == rhs.getHitRatio().getKilled());
+   }
+};
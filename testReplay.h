@@ -0,0 +1,188 @@
+/***********************************************************************
+ * Header File:
+ *    TEST REPLAY : Unit tests for recording and playing back a game
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    A replay has to come back from its file exactly as it went in, and
+ *    playing it has to end the game exactly where the original ended.
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include "replay.h"
+#include "skeet.h"
+#include "bot.h"
+
+#define REPLAY_FILE "testReplay.skrp"
+
+/*********************************************
+ * TEST REPLAY
+ * Unit tests for Replay
+ *********************************************/
+class TestReplay
+{
+public:
+   void run()
+   {
+      save_roundTrip();
+      load_missingFile();
+      load_truncated();
+      load_version1();
+      play_sameGame();
+      remove(REPLAY_FILE);
+   }
+
+private:
+   /*********************************************
+    * every key and every arrow count survives the file
+    *********************************************/
+   void save_roundTrip()
+   {
+      // setup
+      Replay original(0x123456789abcdefULL, Position(640.0, 480.0));
+      for (int i = 0; i < 500; i++)
+      {
+         Input input;
+         input.setDown(i % 7 == 0 ? i : 0);
+         input.setUp(i % 5 == 0 ? 1000 + i : 0);
+         input.setLeft(i / 100);
+         input.setRight(i % 2);
+         input.setSpace(i % 3 == 0 ? 1 + i % 4 : 0);
+         input.setM(i % 11 == 0);
+         input.setB(i > 400);
+         input.setShift(i < 50);
+         original.record(input);
+      }
+      // exercise
+      bool saved = original.save(REPLAY_FILE);
+      Replay copy;
+      bool loaded = copy.load(REPLAY_FILE);
+      // verify
+      assert(saved && loaded);
+      assert(copy.getSeed() == original.getSeed());
+      assert(copy.getDimensions().getX() == 640.0);
+      assert(copy.getDimensions().getY() == 480.0);
+      assert(copy.size() == original.size());
+      for (size_t i = 0; i < copy.size(); i++)
+      {
+         assert(copy[i].isDown()  == original[i].isDown());
+         assert(copy[i].isUp()    == original[i].isUp());
+         assert(copy[i].isLeft()  == original[i].isLeft());
+         assert(copy[i].isRight() == original[i].isRight());
+         assert(copy[i].isSpace() == original[i].isSpace());
+         assert(copy[i].isM()     == original[i].isM());
+         assert(copy[i].isB()     == original[i].isB());
+         assert(copy[i].isShift() == original[i].isShift());
+      }
+   }
+
+   /*********************************************
+    * a file that is not there does not load
+    *********************************************/
+   void load_missingFile()
+   {
+      // setup
+      Replay replay;
+      // exercise
+      bool loaded = replay.load("no such replay.skrp");
+      // verify
+      assert(!loaded);
+      assert(replay.size() == 0);
+   }
+
+   /*********************************************
+    * a file cut short does not load
+    *********************************************/
+   void load_truncated()
+   {
+      // setup
+      Replay original(7, Position(800.0, 800.0));
+      Input input;
+      input.setUp(300);
+      for (int i = 0; i < 10; i++)
+         original.record(input);
+      original.save(REPLAY_FILE);
+      std::ifstream in(REPLAY_FILE, std::ios::binary);
+      std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+      in.close();
+      std::ofstream out(REPLAY_FILE, std::ios::binary | std::ios::trunc);
+      out.write(bytes.data(), bytes.size() - 1);
+      out.close();
+      Replay copy;
+      // exercise
+      bool loaded = copy.load(REPLAY_FILE);
+      // verify
+      assert(!loaded);
+      assert(copy.size() == 0);
+   }
+
+   /*********************************************
+    * an old file fired only the first of space, M,
+    * and B, so it reads back as just that one
+    *********************************************/
+   void load_version1()
+   {
+      // setup
+      std::ofstream out(REPLAY_FILE, std::ios::binary | std::ios::trunc);
+      out.write("SKRP\x01", 5);
+      for (uint64_t value : { (uint64_t)42, (uint64_t)0x4089000000000000ULL, (uint64_t)0x4089000000000000ULL })
+         for (int i = 0; i < 8; i++)
+            out.put((char)(value >> (i * 8)));
+      out.write("\x03"          // 3 frames
+                "\x01\x03"      // space and M
+                "\x01\x06"      // M and B
+                "\x01\x24\x07", // B, and up held for 7 frames
+                8);
+      out.close();
+      Replay replay;
+      // exercise
+      bool loaded = replay.load(REPLAY_FILE);
+      // verify
+      assert(loaded);
+      assert(replay.getSeed() == 42);
+      assert(replay.getDimensions().getX() == 800.0);
+      assert(replay.size() == 3);
+      assert(replay[0].isSpace() == 1 && replay[0].isM() == 0 && replay[0].isB() == 0);
+      assert(replay[1].isSpace() == 0 && replay[1].isM() == 1 && replay[1].isB() == 0);
+      assert(replay[2].isSpace() == 0 && replay[2].isM() == 0 && replay[2].isB() == 1);
+      assert(replay[2].isUp() == 7);
+   }
+
+   /*********************************************
+    * a whole game recorded, written, read, and played
+    * again ends with the same score
+    *********************************************/
+   void play_sameGame()
+   {
+      // setup
+      Position dimensions(800.0, 800.0);
+      Skeet original(dimensions, 99);
+      Replay replay(99, dimensions);
+      RandomBot bot(5);
+      while (!original.getTime().isGameOver())
+      {
+         Input input = bot.play(original);
+         replay.record(input);
+         original.interact(input);
+         original.animate();
+      }
+      replay.save(REPLAY_FILE);
+      Replay copy;
+      copy.load(REPLAY_FILE);
+      Skeet again(dimensions, copy.getSeed());
+      // exercise
+      size_t frames = copy.play(again);
+      // verify
+      assert(frames == replay.size());
+      assert(again.getTime().isGameOver());
+      assert(again.getScore().getPoints() == original.getScore().getPoints());
+      assert(again.getHitRatio().getKilled() == original.getHitRatio().getKilled());
+      assert(again.getHitRatio().getMissed() == original.getHitRatio().getMissed());
+   }
+};
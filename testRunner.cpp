@@ -0,0 +1,46 @@
+/***********************************************************************
+ * Source File:
+ *    TEST RUNNER : Run all the unit tests
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The file that contains main() for skeet-test. Every test asserts,
+ *    so a failure stops the run with the file and line of the problem.
+ ************************************************************************/
+
+#ifdef NDEBUG
+#undef NDEBUG      // the tests are nothing but asserts
+#endif
+
+#include <iostream>
+#include "testPosition.h"
+#include "testCollision.h"
+#include "testRandom.h"
+#include "testReplay.h"
+#include "testPacer.h"
+#include "testProfiler.h"
+#include "testJobs.h"
+#include "testLevels.h"
+#include "testStress.h"
+#include "testInput.h"
+
+/*********************************
+ * MAIN
+ * Run every test class
+ *********************************/
+int main()
+{
+   TestPosition().run();
+   TestCollision().run();
+   TestRandom().run();
+   TestReplay().run();
+   TestPacer().run();
+   TestProfiler().run();
+   TestJobs().run();
+   TestLevels().run();
+   TestStress().run();
+   TestInput().run();
+
+   std::cout << "All tests passed\n";
+   return 0;
+}
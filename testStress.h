@@ -0,0 +1,104 @@
+/***********************************************************************
+ * Header File:
+ *    TEST STRESS : Unit tests for the stress test
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The load has to be topped up to exactly what the step asks for,
+ *    double once the step has its frames, and stop where it was told.
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include "stress.h"
+#include "skeet.h"
+
+/*********************************************
+ * TEST STRESS
+ * Unit tests for Stress and Skeet::fill()
+ *********************************************/
+class TestStress
+{
+public:
+   void run()
+   {
+      parseKinds();
+      fill_topsUp();
+      record_doubles();
+   }
+
+private:
+   /*********************************************
+    * "all", a list, or nothing
+    *********************************************/
+   void parseKinds()
+   {
+      assert(Stress::parseKinds("all") == Stress::ALL);
+      assert(Stress::parseKinds("birds") == Stress::BIRDS);
+      assert(Stress::parseKinds("bombs,fragments") == (Stress::BOMBS | Stress::FRAGMENTS));
+      assert(Stress::parseKinds("birds,eagles") == 0);
+      assert(Stress::parseKinds("") == 0);
+   }
+
+   /*********************************************
+    * fill() adds only what is missing
+    *********************************************/
+   void fill_topsUp()
+   {
+      // setup
+      Position dimensions(800.0, 800.0);
+      Skeet skeet(dimensions, 17, &Stress::getLevels());
+      // exercise
+      skeet.fill(12, 5, 3, 40);
+      skeet.fill(10, 4, 3, 20);
+      // verify
+      size_t missiles = 0;
+      size_t bombs = 0;
+      skeet.getBullets().forEach([&missiles, &bombs](const auto & bullet)
+      {
+         typedef std::decay_t<decltype(bullet)> Kind;
+         missiles += std::is_same_v<Kind, Missile>;
+         bombs += std::is_same_v<Kind, Bomb>;
+      });
+      assert(skeet.getBirds().size() == 12);
+      assert(missiles == 5);
+      assert(bombs == 3);
+      assert(skeet.getBullets().size() == 8);
+      assert(skeet.getEffects().getFragments().size() == 40);
+   }
+
+   /*********************************************
+    * 1, 2, 4, then done, ignoring the status screen
+    *********************************************/
+   void record_doubles()
+   {
+      // setup
+      Position dimensions(800.0, 800.0);
+      Skeet skeet(dimensions, 17, &Stress::getLevels());
+      Stress stress(Stress::BIRDS, 3, 4);
+      int frames = 0;
+      // exercise
+      while (!stress.isDone())
+      {
+         stress.fill(skeet);
+         skeet.animate();
+         if (skeet.isPlaying())
+         {
+            assert(frames / 3 < 3);
+            assert(stress.getScale() == (size_t)1 << (frames / 3));
+            frames++;
+         }
+         stress.record(skeet, 1.0, -1.0);
+      }
+      // verify
+      assert(frames == 9);
+      assert(stress.getScale() == 0);
+      std::ostringstream out;
+      stress.report(out);
+      assert(out.str().find("no step went over") != std::string::npos);
+   }
+};
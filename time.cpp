@@ -11,16 +11,24 @@
 #include <sstream>
 using namespace std;
 
-#define SECONDS_STATUS 5.0
+/************************
+ * TIME constructor
+ ************************/
+Time::Time(const vector<int> & seconds)
+{
+    assert(!seconds.empty());
+    levelLength.push_back(0);
+    levelLength.insert(levelLength.end(), seconds.begin(), seconds.end());
+    reset();
+}
 
 /************************
  * TIME reset
- * Set up the levels and stuff
+ * Back to the start of the first level
  ************************/
 void Time::reset()
 {
-    // first level is 30 seconds in length, the first 5 are the status time
-    levelLength = {0, 30, 30, 45, 45};
+    // the first 5 seconds of every level are the status time
     levelNumber = 1;
     framesLeft = FRAMES_PER_SECOND * levelLength[levelNumber];
 }
@@ -8,11 +8,12 @@
  ************************************************************************/
 
 #pragma once
-#include <array>
+#include <vector>
 #include <string>
 #include <cassert>
 
 #define FRAMES_PER_SECOND 30
+#define SECONDS_STATUS 5.0
 
 /************************
  * TIME
@@ -21,7 +22,8 @@
 class Time
 {
 public:
-    Time() { reset(); }
+    // [seconds] is how long each level is, the first level first
+    Time(const std::vector<int> & seconds);
     
     // which level are we in?
     int level() const  { return levelNumber; }
@@ -60,8 +62,8 @@ private:
     // the level number we are currently in
     int levelNumber;
     
-    // length in seconds of each level
-    std::array<int, 5> levelLength;
+    // length in seconds of each level, after a 0 for Game Over
+    std::vector<int> levelLength;
     
     // seconds from frames
     int secondsFromFrames(int frame) const
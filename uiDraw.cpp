@@ -0,0 +1,414 @@
+/***********************************************************************
+ * Source File:
+ *    UI DRAW : Draw primitive shapes on the screen
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The only place outside of uiInteract that talks to OpenGL. Every
+ *    shape in the game is made out of these primitives.
+ *
+ *    The primitives do not draw right away. They add their triangles
+ *    or lines to a queue, and the queue goes to OpenGL as one vertex
+ *    array when the kind of primitive changes, when text is drawn, or
+ *    at the end of the frame. A frame is a handful of draw calls no
+ *    matter how many birds, bullets, and fragments are on the screen.
+ ************************************************************************/
+
+#include <cassert>
+#include <vector>
+#include "uiDraw.h"
+
+#ifdef __APPLE__
+#define GL_SILENCE_DEPRECATION
+#include <openGL/gl.h>    // Main OpenGL library
+#include <GLUT/glut.h>    // Second OpenGL library
+#define GLUT_TEXT GLUT_BITMAP_HELVETICA_18
+#endif // __APPLE__
+
+#ifdef __linux__
+#include <GL/gl.h>        // Main OpenGL library
+#include <GL/glut.h>      // Second OpenGL library
+#define GLUT_TEXT GLUT_BITMAP_HELVETICA_12
+#endif // __linux__
+
+#ifdef _WIN32
+#include <stdio.h>
+#include <stdlib.h>
+#include <GL/glut.h>         // OpenGL library we copied 
+#define _USE_MATH_DEFINES
+#include <math.h>
+#define GLUT_TEXT GLUT_BITMAP_HELVETICA_12
+#endif // _WIN32
+
+using namespace std;
+
+/************************************************************************
+ * ROTATE
+ * Rotate a given point (point) around a given origin (center) by a given
+ * number of degrees (angle).
+ *    INPUT  origin   The center point we will rotate around
+ *           x,y      Offset from center that we will be rotating
+ *           rotation Rotation in degrees
+ *    OUTPUT point    The new position
+ *************************************************************************/
+Position rotate(const Position& origin,
+   double x, double y, double rotation) 
+{
+   // because sine and cosine are expensive, we want to call them only once
+   double cosA = cos(rotation);
+   double sinA = sin(rotation);
+
+   // start with our original point
+   Position ptReturn(origin);
+
+   // find the new values
+   ptReturn.addX(x * cosA - y * sinA);
+   ptReturn.addY(y * cosA + x * sinA /*center of rotation*/);
+
+   return ptReturn;
+}
+
+/***************************************************************/
+/***************************************************************/
+/*                         RENDER QUEUE                        */
+/***************************************************************/
+/***************************************************************/
+
+/*************************************************************************
+ * VERTEX
+ * One corner of a triangle or end of a line, with its color
+ *************************************************************************/
+struct Vertex
+{
+   GLfloat x, y;
+   GLfloat red, green, blue;
+};
+
+// everything drawn since the last flush. It is all one kind of
+// primitive, so it goes to the card in a single glDrawArrays().
+static vector<Vertex> queue;
+static GLenum queueMode = GL_TRIANGLES;
+
+/*************************************************************************
+ * QUEUE BEGIN
+ * Switching between triangles and lines sends what we have
+ * so far, which keeps everything in the order it was drawn
+ *************************************************************************/
+inline void queueBegin(GLenum mode)
+{
+   if (mode != queueMode)
+   {
+      drawFlush();
+      queueMode = mode;
+   }
+}
+
+/*************************************************************************
+ * QUEUE VERTEX
+ *************************************************************************/
+inline void queueVertex(double x, double y, double red, double green, double blue)
+{
+   Vertex vertex = { (GLfloat)x, (GLfloat)y, (GLfloat)red, (GLfloat)green, (GLfloat)blue };
+   queue.push_back(vertex);
+}
+inline void queueVertex(const Position& point, double red, double green, double blue)
+{
+   queueVertex(point.getX(), point.getY(), red, green, blue);
+}
+
+/*************************************************************************
+ * DRAW FLUSH
+ * Send everything in the queue to OpenGL in one call
+ *************************************************************************/
+void drawFlush()
+{
+   if (queue.empty())
+      return;
+
+   glEnableClientState(GL_VERTEX_ARRAY);
+   glEnableClientState(GL_COLOR_ARRAY);
+   glVertexPointer(2, GL_FLOAT, sizeof(Vertex), &queue[0].x);
+   glColorPointer(3, GL_FLOAT, sizeof(Vertex), &queue[0].red);
+   glDrawArrays(queueMode, 0, (GLsizei)queue.size());
+   glDisableClientState(GL_COLOR_ARRAY);
+   glDisableClientState(GL_VERTEX_ARRAY);
+
+   // back to white, the way every primitive used to leave it
+   glColor3f((GLfloat)1.0 /* red % */, (GLfloat)1.0 /* green % */, (GLfloat)1.0 /* blue % */);
+   queue.clear();
+}
+
+/***************************************************************/
+/***************************************************************/
+/*                          PRIMITIVES                         */
+/***************************************************************/
+/***************************************************************/
+
+/************************************************************************
+ * DRAW RECTANGLE
+ * Draw a rectangle on the screen from the beginning to the end.
+ *************************************************************************/
+void drawRectangle(const Position& pt,
+                   double angle,
+                   double width,
+                   double height,
+                   double red,
+                   double green,
+                   double blue)
+{
+   queueBegin(GL_TRIANGLES);
+
+   // the four corners
+   Position pt1 = rotate(pt,  width / 2.0,  height / 2.0, angle);
+   Position pt2 = rotate(pt,  width / 2.0, -height / 2.0, angle);
+   Position pt3 = rotate(pt, -width / 2.0, -height / 2.0, angle);
+   Position pt4 = rotate(pt, -width / 2.0,  height / 2.0, angle);
+
+   // two triangles make the rectangle
+   queueVertex(pt1, red, green, blue);
+   queueVertex(pt2, red, green, blue);
+   queueVertex(pt3, red, green, blue);
+   queueVertex(pt1, red, green, blue);
+   queueVertex(pt3, red, green, blue);
+   queueVertex(pt4, red, green, blue);
+}
+
+/*************************************************************************
+ * CIRCLE
+ * The corners of a unit circle cut into a given number of
+ * segments. The last corner is the first one again.
+ *************************************************************************/
+struct Circle
+{
+   Circle(int segments) : segments(segments)
+   {
+      for (int i = 0; i <= segments; i++)
+      {
+         double radians = (i == segments ? 0.0 : M_PI * 2.0 * i / segments);
+         x.push_back(cos(radians));
+         y.push_back(sin(radians));
+      }
+   }
+
+   int segments;
+   vector<double> x;
+   vector<double> y;
+};
+
+// the levels of detail, from the smallest dots to the biggest birds
+#define NUM_CIRCLES 5
+static const int CIRCLE_SEGMENTS[NUM_CIRCLES] = { 8, 16, 32, 64, 128 };
+
+/*************************************************************************
+ * GET CIRCLE
+ * The level of detail for a disk: the fewest segments that keep
+ * every edge under about four pixels, so a radius 15 bird gets 32
+ * and a radius 30 bird gets 64. The tables are made the first time
+ * they are needed and never again.
+ *************************************************************************/
+static const Circle & getCircle(double radius)
+{
+   static const Circle circles[NUM_CIRCLES] =
+   {
+      Circle(CIRCLE_SEGMENTS[0]), Circle(CIRCLE_SEGMENTS[1]), Circle(CIRCLE_SEGMENTS[2]),
+      Circle(CIRCLE_SEGMENTS[3]), Circle(CIRCLE_SEGMENTS[4])
+   };
+
+   double segments = M_PI * 2.0 * radius / 4.0;
+   for (int i = 0; i < NUM_CIRCLES; i++)
+      if (CIRCLE_SEGMENTS[i] >= segments)
+         return circles[i];
+   return circles[NUM_CIRCLES - 1];
+}
+
+/************************************************************************
+ * DRAW Disk
+ * Draw a filled circule at [center] with size [radius]
+ *************************************************************************/
+void drawDisk(const Position& center, double radius,
+              double red, double green, double blue)
+{
+   assert(radius > 1.0);
+   const Circle & circle = getCircle(radius);
+
+   queueBegin(GL_TRIANGLES);
+
+   // a triangle from the center to each segment of the edge
+   for (int i = 0; i < circle.segments; i++)
+   {
+      queueVertex(center, red, green, blue);
+      queueVertex(center.getX() + radius * circle.x[i],
+                  center.getY() + radius * circle.y[i], red, green, blue);
+      queueVertex(center.getX() + radius * circle.x[i + 1],
+                  center.getY() + radius * circle.y[i + 1], red, green, blue);
+   }
+}
+
+/************************************************************************
+ * DRAW LINE
+ * Draw a line on the screen from the beginning to the end.
+ *************************************************************************/
+void drawLine(const Position& begin, const Position& end,
+              double red, double green, double blue)
+{
+   queueBegin(GL_LINES);
+   queueVertex(begin, red, green, blue);
+   queueVertex(end,   red, green, blue);
+}
+
+/************************************************************************
+ * DRAW DOT
+ * Draw a single point (square actually on the screen, r pixels by r pixels
+ *************************************************************************/
+void drawDot(const Position& point, double radius,
+             double red, double green, double blue)
+{
+   queueBegin(GL_TRIANGLES);
+   double r = radius / 2.0;
+
+   // two triangles make the square
+   queueVertex(point.getX() - r, point.getY() - r, red, green, blue);
+   queueVertex(point.getX() + r, point.getY() - r, red, green, blue);
+   queueVertex(point.getX() + r, point.getY() + r, red, green, blue);
+   queueVertex(point.getX() - r, point.getY() - r, red, green, blue);
+   queueVertex(point.getX() + r, point.getY() + r, red, green, blue);
+   queueVertex(point.getX() - r, point.getY() + r, red, green, blue);
+}
+
+/************************************************************************
+ * DRAW Background
+ * Fill in the background
+ *  INPUT dimensions  Size of the screen
+ *        color       Background color
+ *************************************************************************/
+void drawBackground(const Position& dimensions,
+                    double redBack, double greenBack, double blueBack)
+{
+   // two triangles is the fastest way to fill the screen.
+   drawRectangle(Position(dimensions.getX() / 2.0, dimensions.getY() / 2.0),
+                 0.0, dimensions.getX(), dimensions.getY(),
+                 redBack, greenBack, blueBack);
+}
+
+/************************************************************************
+ * DRAW Timer
+ * Draw a large timer on the screen
+ *  INPUT dimensions  Size of the screen
+ *        percent     Amount of time left
+ *        Foreground  Foreground color
+ *        Background  Background color
+ *************************************************************************/
+void drawTimer(const Position& dimensions, double percent,
+               double redFore, double greenFore, double blueFore,
+               double redBack, double greenBack, double blueBack)
+{
+   double radians;
+
+   double length = dimensions.getX();
+   double half = length / 2.0;
+
+   // do the background stuff
+   drawBackground(dimensions, redBack, greenBack, blueBack);
+
+   // foreground stuff
+   radians = percent * M_PI * 2.0;
+   double x_extent = half + length * sin(radians);
+   double y_extent = half + length * cos(radians);
+
+   // the outside of the fan around the center, one eighth at a time
+   vector<Position> fan;
+   switch ((int)(percent * 8.0))
+   {
+   case 7: // 315 - 360
+      fan = { Position(half, length), Position(length, length), Position(length, 0.0),
+              Position(0.0, 0.0), Position(0.0, length) };
+      break;
+   case 6: // 270 - 315
+      fan = { Position(half, length), Position(length, length), Position(length, 0.0),
+              Position(0.0, 0.0), Position(0.0, half) };
+      break;
+   case 5: // 225 - 270
+      fan = { Position(half, length), Position(length, length), Position(length, 0.0),
+              Position(0.0, 0.0) };
+      break;
+   case 4: // 180 - 225
+      fan = { Position(half, length), Position(length, length), Position(length, 0.0),
+              Position(half, 0.0) };
+      break;
+   case 3: // 135 - 180
+      fan = { Position(half, length), Position(length, length), Position(length, half),
+              Position(length, 0.0) };
+      break;
+   case 2: // 90 - 135 degrees
+      fan = { Position(half, length), Position(length, length), Position(length, half) };
+      break;
+   case 1: // 45 - 90 degrees
+      fan = { Position(half, length), Position(length, length) };
+      break;
+   case 0: // 0 - 45 degrees
+      fan = { Position(half, length) };
+      break;
+   }
+   fan.push_back(Position(x_extent, y_extent));
+
+   // a triangle from the center to each edge of the fan
+   queueBegin(GL_TRIANGLES);
+   Position center(half, half);
+   for (size_t i = 0; i + 1 < fan.size(); i++)
+   {
+      queueVertex(center,     redFore, greenFore, blueFore);
+      queueVertex(fan[i],     redFore, greenFore, blueFore);
+      queueVertex(fan[i + 1], redFore, greenFore, blueFore);
+   }
+
+   // draw the red line now
+   drawLine(center, Position(x_extent, y_extent), 0.6, 0.0, 0.0);
+}
+
+/*************************************************************************
+ * DRAW TEXT
+ * Draw text using a simple bitmap font
+ *   INPUT  topLeft   The top left corner of the text
+ *          text      The text to be displayed
+ *          color     Color of the text, white by default
+ ************************************************************************/
+void drawText(const Position& topLeft, const char* text,
+              double red, double green, double blue)
+{
+   // text goes straight to the screen, so draw everything under it first
+   drawFlush();
+
+   void* pFont = GLUT_TEXT;
+   glColor3f((GLfloat)red, (GLfloat)green, (GLfloat)blue);
+
+   // prepare to output the text from the top-left corner
+   glRasterPos2f((GLfloat)topLeft.getX(), (GLfloat)topLeft.getY());
+
+   // loop through the text
+   for (const char* p = text; *p; p++)
+      glutBitmapCharacter(pFont, *p);
+}
+void drawText(const Position & topLeft, const string & text,
+              double red, double green, double blue)
+{
+   drawText(topLeft, text.c_str(), red, green, blue);
+}
+
+/************************
+ * DRAW BULLSEYE
+ * Put a bullseye on the screen where the gun is pointing
+ ************************/
+void drawBullseye(const Position& dimensions, double angle)
+{
+   // find where we are pointing
+   double distance = dimensions.getX();
+   double x = dimensions.getX() - distance * cos(angle);
+   double y = distance * sin(angle);
+
+   // draw the crosshairs
+   drawLine(Position(x - 10.0, y), Position(x + 10.0, y), 0.6, 0.6, 0.6);
+   drawLine(Position(x, y - 10.0), Position(x, y + 10.0), 0.6, 0.6, 0.6);
+
+   // and the line back to the gun
+   drawLine(Position(dimensions.getX(), 0.0), Position(x, y), 0.2, 0.2, 0.2);
+}
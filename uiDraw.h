@@ -0,0 +1,93 @@
+/***********************************************************************
+ * Header File:
+ *    UI DRAW : Draw primitive shapes on the screen
+ * Author:
+ *    Br. Helfrich
+ * Summary:
+ *    The only place outside of uiInteract that talks to OpenGL. Every
+ *    shape in the game is made out of these primitives. They are
+ *    queued up and sent to OpenGL together by drawFlush().
+ ************************************************************************/
+
+#pragma once
+
+#include <string>
+#include "position.h"
+
+/************************************************************************
+ * DRAW FLUSH
+ * Send everything drawn so far to OpenGL. Called at the end of every
+ * frame; the primitives call it themselves when they need to.
+ *************************************************************************/
+void drawFlush();
+
+/************************************************************************
+ * ROTATE
+ * Rotate a given point (point) around a given origin (center) by a given
+ * number of degrees (angle).
+ *************************************************************************/
+Position rotate(const Position& origin,
+                double x, double y, double rotation);
+
+/************************************************************************
+ * DRAW DISK
+ * Draw a filled circule at [center] with size [radius]
+ *************************************************************************/
+void drawDisk(const Position& center, double radius,
+              double red, double green, double blue);
+
+/************************************************************************
+ * DRAW LINE
+ * Draw a line on the screen from the beginning to the end.
+ *************************************************************************/
+void drawLine(const Position& begin, const Position& end,
+              double red = 1.0, double green = 1.0, double blue = 1.0);
+
+/************************************************************************
+ * DRAW DOT
+ * Draw a single point (square actually on the screen, r pixels by r pixels
+ *************************************************************************/
+void drawDot(const Position& point, double radius = 2.0,
+             double red = 1.0, double green = 1.0, double blue = 1.0);
+
+/************************************************************************
+ * DRAW RECTANGLE
+ * Draw a rectangle on the screen centered on a point and rotated
+ *************************************************************************/
+void drawRectangle(const Position& pt,
+                   double angle = 0.0,
+                   double width = 10.0,
+                   double height = 100.0,
+                   double red = 1.0,
+                   double green = 1.0,
+                   double blue = 1.0);
+
+/************************************************************************
+ * DRAW BACKGROUND
+ * Fill the screen with one color
+ *************************************************************************/
+void drawBackground(const Position& dimensions,
+                    double redBack, double greenBack, double blueBack);
+
+/************************************************************************
+ * DRAW TIMER
+ * Draw a large timer on the screen
+ *************************************************************************/
+void drawTimer(const Position& dimensions, double percent,
+               double redFore, double greenFore, double blueFore,
+               double redBack, double greenBack, double blueBack);
+
+/************************************************************************
+ * DRAW BULLSEYE
+ * Draw crosshairs where the gun is pointing
+ *************************************************************************/
+void drawBullseye(const Position& dimensions, double angle);
+
+/*************************************************************************
+ * DRAW TEXT
+ * Draw text using a simple bitmap font
+ ************************************************************************/
+void drawText(const Position& topLeft, const char* text,
+              double red = 1.0, double green = 1.0, double blue = 1.0);
+void drawText(const Position& topLeft, const std::string& text,
+              double red = 1.0, double green = 1.0, double blue = 1.0);
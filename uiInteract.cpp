@@ -13,8 +13,6 @@
 #include <string>     // need you ask?
 #include <sstream>    // convert an integer into text
 #include <cassert>    // I feel the need... the need for asserts
-#include <time.h>     // for clock
-#include <cstdlib>    // for rand()
 
 
 #ifdef __APPLE__
@@ -40,38 +38,15 @@
 #endif // _WIN32
 
 #include "uiInteract.h"
+#include "uiDraw.h"
 #include "position.h"
 
 using namespace std;
 
+// the one window GLUT draws and sends keys to. Its callbacks are plain
+// functions, so this is how they find it
+static UserInput * window = NULL;
 
-/*********************************************************************
- * SLEEP
- * Pause for a while.  We want to put the program to sleep until it
- * is time to output again.  Note that this requires us to tell the OS
- * that we are idle.  the nanosleep function performs this task for us
- *   INPUT: msSleep: sleep time in milliseconds
- *********************************************************************/
-void sleep(unsigned long msSleep)
-{
-   // Windows handles sleep one way
-#ifdef _WIN32
-   ::Sleep(msSleep + 35);
-
-   // Unix-based operating systems (OS-X, Linux) do it another
-#else // LINUX, XCODE
-   timespec req = {};
-   time_t sec = (int)(msSleep / 1000);
-   msSleep -= (sec * 1000);
-
-   req.tv_sec = sec;
-   req.tv_nsec = msSleep * 1000000L;
-
-   while (nanosleep(&req, &req) == -1)
-      ;
-#endif // LINUX, XCODE
-   return;
-}
 
 /************************************************************************
  * DRAW CALLBACK
@@ -85,8 +60,8 @@ void sleep(unsigned long msSleep)
  *************************************************************************/
 void drawCallback()
 {
-   // even though this is a local variable, all the members are static
-   UserInput ui;
+   assert(window != NULL);
+   UserInput & ui = *window;
    // Prepare the background buffer for drawing
    glClear(GL_COLOR_BUFFER_BIT); //clear the screen
    glColor3f((GLfloat)1.0 /* red % */, (GLfloat)1.0 /* green % */, (GLfloat)1.0 /* blue % */);
@@ -94,19 +69,13 @@ void drawCallback()
    //calls the client's display function
    assert(ui.callBack != NULL);
    ui.callBack(&ui, ui.p);
+   drawFlush();
    
-   //loop until the timer runs out
-   if (!ui.isTimeToDraw())
-      sleep((unsigned long)((ui.getNextTick() - clock()) / 1000));
-
-   // from this point, set the next output time
-   ui.setNextDrawTime();
+   // wait until it is time for this frame to go out
+   ui.waitForFrame();
 
    // bring forth the background buffer
    glutSwapBuffers();
-
-   // clear the space at the end
-   ui.keyEvent();
 }
 
 /************************************************************************
@@ -118,10 +87,8 @@ void drawCallback()
  *************************************************************************/
 void keyDownCallback(int key, int x, int y)
 {
-   // Even though this is a local variable, all the members are static
-   // so we are actually getting the same version as in the constructor.
-   UserInput ui;
-   ui.keyEvent(key, true /*fDown*/);
+   assert(window != NULL);
+   window->keyEvent(key, true /*fDown*/, glutGetModifiers() == GLUT_ACTIVE_SHIFT);
 }
 
 /************************************************************************
@@ -132,10 +99,8 @@ void keyDownCallback(int key, int x, int y)
  *************************************************************************/
 void keyUpCallback(int key, int x, int y)
 {
-   // Even though this is a local variable, all the members are static
-   // so we are actually getting the same version as in the constructor.
-   UserInput ui;
-   ui.keyEvent(key, false /*fDown*/);
+   assert(window != NULL);
+   window->keyEvent(key, false /*fDown*/, glutGetModifiers() == GLUT_ACTIVE_SHIFT);
 }
 
 /***************************************************************
@@ -145,10 +110,8 @@ void keyUpCallback(int key, int x, int y)
  ***************************************************************/
 void keyboardCallback(unsigned char key, int x, int y)
 {
-   // Even though this is a local variable, all the members are static
-   // so we are actually getting the same version as in the constructor.
-   UserInput ui;
-   ui.keyEvent(key, true /*fDown*/);
+   assert(window != NULL);
+   window->keyEvent(key, true /*fDown*/, glutGetModifiers() == GLUT_ACTIVE_SHIFT);
 }
 
 /************************************************************************
@@ -165,111 +128,50 @@ void closeCallback()
  * Either set the up or down event for a given key
  *   INPUT   key     which key is pressed
  *           fDown   down or brown
+ *           shift   is shift held down?
  ****************************************************************/
-void UserInput::keyEvent(int key, bool fDown)
+void UserInput::keyEvent(int key, bool fDown, bool shift)
 {
    switch(key)
    {
       case GLUT_KEY_DOWN:
-         isDownPress = fDown;
+         keys.push(InputQueue::DOWN, fDown, shift);
          break;
       case GLUT_KEY_UP:
-         isUpPress = fDown;
+         keys.push(InputQueue::UP, fDown, shift);
          break;
       case GLUT_KEY_RIGHT:
-         isRightPress = fDown;
+         keys.push(InputQueue::RIGHT, fDown, shift);
          break;
       case GLUT_KEY_LEFT:
-         isLeftPress = fDown;
+         keys.push(InputQueue::LEFT, fDown, shift);
          break;
       case GLUT_KEY_HOME:
       case ' ':
-         isSpacePress = fDown;
+         keys.push(InputQueue::SPACE, fDown, shift);
          break;
       case 'b':
-         isBPress = fDown;
+         keys.push(InputQueue::B, fDown, shift);
          break;
       case 'm':
-         isMPress = fDown;
+         keys.push(InputQueue::M, fDown, shift);
+         break;
+      case 'p':
+         isPPress = isPPress || fDown;
          break;
    }
-
-   isShiftPress = (glutGetModifiers () == GLUT_ACTIVE_SHIFT);
 }
 
 /***************************************************************
- * INTERFACE : KEY EVENT
- * Either set the up or down event for a given key
- *   INPUT   key     which key is pressed
- *           fDown   down or brown
+ * INTERFACE : TAKE INPUT
+ * Hand the keys to one step of the simulation
  ****************************************************************/
-void UserInput::keyEvent()
+Input UserInput::takeInput(Pacer::Clock::time_point time)
 {
-   if (isDownPress)
-      isDownPress++;
-   if (isUpPress)
-      isUpPress++;
-   if (isLeftPress)
-      isLeftPress++;
-   if (isRightPress)
-      isRightPress++;
-   isSpacePress = false;
-   isMPress = false;
-   isBPress = false;
+   isPPress = false;
+   return keys.take(time);
 }
 
-/************************************************************************
- * INTEFACE : IS TIME TO DRAW
- * Have we waited long enough to output swap the background buffer with
- * the foreground buffer?
- *************************************************************************/
-bool UserInput::isTimeToDraw()
-{
-   return ((unsigned int)clock() >= nextTick);
-}
-
-/************************************************************************
- * INTERFACE : SET NEXT DRAW TIME
- * What time should we output the buffer again?  This is a function of
- * the current time and the frames per second.
- *************************************************************************/
-void UserInput::setNextDrawTime()
-{
-   nextTick = clock() + static_cast<int> (timePeriod * CLOCKS_PER_SEC);
-}
-
-/************************************************************************
- * INTERFACE : SET FRAMES PER SECOND
- * The frames per second dictates the speed of the game.  The more frames
- * per second, the quicker the game will appear to the user.  We will default
- * to 30 frames/second but the client can set this at will.
- *    INPUT  value        The number of frames per second.  30 is default
- *************************************************************************/
-void UserInput::setFramesPerSecond(double value)
-{
-    timePeriod = (1 / value);
-}
-
-/***************************************************
- * STATICS
- * All the static member variables need to be initialized
- * Somewhere globally.  This is a good spot
- **************************************************/
-int          UserInput::isDownPress  = 0;
-int          UserInput::isUpPress    = 0;
-int          UserInput::isLeftPress  = 0;
-int          UserInput::isRightPress = 0;
-bool         UserInput::isSpacePress = false;
-bool         UserInput::isMPress     = false;
-bool         UserInput::isBPress     = false;
-bool         UserInput::isShiftPress = false;
-bool         UserInput::initialized  = false;
-double       UserInput::timePeriod   = 1.0 / 30; // default to 30 frames/second
-unsigned long UserInput::nextTick     = 0;        // redraw now please
-void *       UserInput::p            = NULL;
-void (*UserInput::callBack)(const UserInput *, void *) = NULL;
-
-
 /************************************************************************
  * INTEFACE : INITIALIZE
  * Initialize our drawing window.  This will set the size and position,
@@ -281,12 +183,10 @@ void (*UserInput::callBack)(const UserInput *, void *) = NULL;
  *************************************************************************/
 void UserInput::initialize(int argc, char ** argv, const char * title, const Position & dimensions)
 {
-   if (initialized)
-      return;
+   // GLUT only has the one window
+   assert(window == NULL);
+   window = this;
    
-   // set up the random number generator
-   srand((unsigned int)time(NULL));
-
    // create the window
    glutInit(&argc, argv);
    glutInitWindowSize((int)dimensions.getX() * 2, (int)dimensions.getY() * 2);   // size of the window
@@ -313,7 +213,6 @@ void UserInput::initialize(int argc, char ** argv, const char * title, const Pos
 #ifdef __APPLE__
    glutWMCloseFunc(   closeCallback   );
 #endif 
-   initialized = true;
    
    // done
    return;
@@ -330,7 +229,7 @@ void UserInput::initialize(int argc, char ** argv, const char * title, const Pos
  *                   will need to cast this back to your own data
  *                   type before using it.
  *************************************************************************/
-void UserInput::run(void (*callBack)(const UserInput *, void *), void *p)
+void UserInput::run(void (*callBack)(UserInput *, void *), void *p)
 {
    // setup the callbacks
    this->p = p;
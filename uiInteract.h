@@ -6,17 +6,23 @@
  * Summary:
  *    This module will create an OpenGL window,
  *    enter the OpenGL main loop, and accept events.
+ *    Everything is kept in the UserInput itself; GLUT only
+ *    knows about the one window there is, so that is the one
+ *    thing the callbacks have to find globally.
  *    The main methods are:
  *    1. Constructors - Create the window
  *    2. run()        - Run the main loop
  *    3. callback     - Specified in Run, this user-provided
  *                      function will get called with every frame
- *    4. isDown()     - Is a given key pressed on this loop?
+ *    4. takeInput()  - The keys pressed since the last step
  **********************************************/
 
 #pragma once
 
 #include "position.h"
+#include "input.h"
+#include "inputQueue.h"
+#include "pacer.h"
 #include <algorithm> // used for min() and max() (specifically required by Visual Studio)
 using std::min;
 using std::max;
@@ -29,68 +35,58 @@ using std::max;
 class UserInput
 {
 public:
-   // Default constructor useful for setting up the random variables
-   // or for opening the file for output
-   UserInput() {  }
+   // Input without a window: key events come from keyEvent() and
+   // go to whoever takes them
+   UserInput() : p(NULL), callBack(NULL), pacer(30.0), isPPress(false) {  }
 
    // Constructor if you want to set up the window with anything but
-   // the default parameters
-   UserInput(int argc, char ** argv, const char * title, const Position & dimensions)
+   // the default parameters. There can only be one window
+   UserInput(int argc, char ** argv, const char * title, const Position & dimensions) :
+      p(NULL), callBack(NULL), pacer(30.0), isPPress(false)
    {
       initialize(argc, argv, title, dimensions);
    }
+   UserInput(const UserInput &) = delete;
+   UserInput & operator = (const UserInput &) = delete;
 
    // This will set the game in motion
-   void run(void (*callBack)(const UserInput *, void *), void *p);
+   void run(void (*callBack)(UserInput *, void *), void *p);
 
-   // Is it time to redraw the screen
-   bool isTimeToDraw();
-
-   // Set the next output time based on current time and time period
-   void setNextDrawTime();
+   // How many frames per second are we configured for?
+   void setFramesPerSecond(double value) { pacer.setFramesPerSecond(value); }
 
-   // Retrieve the next tick time... the time of the next output.
-   unsigned long getNextTick() { return nextTick; };
+   // Wait until it is time for the next frame to go out
+   void waitForFrame() { pacer.wait(); }
 
-   // How many frames per second are we configured for?
-   void setFramesPerSecond(double value);
+   // How steady the frames have been
+   const Pacer & getPacer() const { return pacer; }
    
-   // Key event indicating a key has been pressed or not.  The callbacks
-   // should be the only onces to call this
-   void keyEvent(int key, bool fDown);
-   void keyEvent();
+   // Key event indicating a key has been pressed or not, with shift
+   // down or not.  With a window, the callbacks call this
+   void keyEvent(int key, bool fDown, bool shift);
 
    // Current frame rate
-   double frameRate() const { return timePeriod;   }
+   double frameRate() const { return pacer.getFramesPerSecond(); }
    
-   // Get various key events
-   int  isDown()      const { return isDownPress;  }
-   int  isUp()        const { return isUpPress;    }
-   int  isLeft()      const { return isLeftPress;  }
-   int  isRight()     const { return isRightPress; }
-   bool isSpace()     const { return isSpacePress; }
-   bool isM()         const { return isMPress;     }
-   bool isB()         const { return isBPress;     }
-   bool isShift()     const { return isShiftPress; }
-
-   static void *p;                   // for client
-   static void (*callBack)(const UserInput *, void *);
+   // Was P pressed since the last step? It is not part of the game
+   bool isP()         const { return isPPress;     }
+
+   // The keys for one step of the simulation: every key event up to
+   // [time], when the step was due. Each is seen by exactly one step,
+   // the one it happened in, no matter how many frames are drawn or
+   // how late they are.
+   Input takeInput(Pacer::Clock::time_point time = Pacer::Clock::now());
+
+   void *p;                          // for client
+   void (*callBack)(UserInput *, void *);
 
 private:
    void initialize(int argc, char ** argv, const char * title, const Position & dimensions);
 
-   static bool         initialized;  // only run the constructor once!
-   static double       timePeriod;   // interval between frame draws
-   static unsigned long nextTick;     // time (from clock()) of our next output
-
-   static int  isDownPress;          // is the down arrow currently pressed?
-   static int  isUpPress;            //    "   up         "
-   static int  isLeftPress;          //    "   left       "
-   static int  isRightPress;         //    "   right      "
-   static bool isSpacePress;         //    "   space      "
-   static bool isBPress;             //    "   B          "
-   static bool isMPress;             //    "   N          "
-   static bool isShiftPress;         //    "   shift key  "
+   Pacer        pacer;               // when the next frame goes out
+
+   InputQueue   keys;                // the keys on their way to the game
+   bool isPPress;                    // was P pressed since the last step?
 };
 
 